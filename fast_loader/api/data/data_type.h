@@ -33,6 +33,28 @@ enum class TraversalType {
   NAIVE, ///< Naive traversal type
   CUSTOM ///< Custom traversal type
 };
+
+/// \brief Downsampling used to synthesize the virtual pyramid levels
+enum class DownsamplingType {
+  MEAN, ///< Mean of the samples, rounded for integral types
+  MAX, ///< Maximum of the samples
+  MODE ///< Most frequent sample, the lowest in case of tie, for label images
+};
+
+/// \brief Allocation of the views and tiles buffers
+enum class BufferAllocationType {
+  DEFAULT, ///< Default allocation (new[] / std::vector)
+  ALIGNED, ///< Buffers aligned on a cache line (64 bytes)
+  HUGE_PAGE, ///< Large buffers backed by transparent huge pages
+  EXPLICIT_HUGE_PAGE, ///< Large buffers backed by the reserved huge pages pool, transparent huge pages if exhausted
+  CUSTOM ///< Custom buffer allocator
+};
+
+/// \brief Admission of the missed tiles in the TileLoader cache
+enum class CacheAdmissionType {
+  ALWAYS, ///< Every missed tile is admitted as the most recently used tile (LRU)
+  TINY_LFU ///< A missed tile is promoted only if accessed more often than the tile it evicts, else evicted next
+};
 }
 
 #endif //FAST_LOADER_DATA_TYPE_H
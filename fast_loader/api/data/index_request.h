@@ -24,6 +24,8 @@
 #include <cstddef>
 #include <ostream>
 #include <iterator>
+#include <memory>
+#include "request_handle.h"
 
 /// @brief FastLoader namespace
 namespace fl {
@@ -33,15 +35,25 @@ namespace fl {
 struct IndexRequest {
   std::vector<size_t> const index_{}; ///< Index
   size_t level_; ///< Level
+  bool noCache_ = false; ///< Hint to not promote the tiles loaded for the request in the cache, for batch traversals
+  int priority_ = 0; ///< Priority, the requests with a higher priority are admitted first in the graph
+  std::shared_ptr<RequestHandle> handle_ = nullptr; ///< Handle to cancel the request, nullptr if not cancellable
 
   /// @brief Index request constructor from view index and view pyramidal level
   /// @param index View index requested
   /// @param level View pyramidal level
-  IndexRequest(std::vector<size_t> index, size_t const &level) : index_(std::move(index)), level_(level) {}
+  /// @param noCache Hint to not promote the tiles loaded for the request in the cache [default false]
+  /// @param priority Priority, the requests with a higher priority are admitted first in the graph [default 0]
+  IndexRequest(std::vector<size_t> index, size_t const &level, bool noCache = false, int priority = 0)
+      : index_(std::move(index)), level_(level), noCache_(noCache), priority_(priority) {}
 
   /// @brief Default destructor
   virtual ~IndexRequest() = default;
 
+  /// @brief Cancelled flag accessor
+  /// @return True if the request has been cancelled through its handle
+  [[nodiscard]] bool cancelled() const { return handle_ && handle_->cancelled(); }
+
   /// @brief Stream output operator
   /// @param os Input stream
   /// @param request Request to print
@@ -49,7 +61,7 @@ struct IndexRequest {
   friend std::ostream &operator<<(std::ostream &os, IndexRequest const &request) {
     os << "Index request [";
     std::copy(request.index_.cbegin(), request.index_.cend(), std::ostream_iterator<size_t>(os, ", "));
-    os << "] level: " << request.level_;
+    os << "] level: " << request.level_ << " priority: " << request.priority_;
     return os;
   }
 };
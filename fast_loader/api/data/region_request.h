@@ -0,0 +1,60 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+
+#ifndef FAST_LOADER_REGION_REQUEST_H
+#define FAST_LOADER_REGION_REQUEST_H
+
+#include "index_request.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+
+/// @brief Data structure to represent a requested region, an arbitrary box in the file not aligned on the tiles
+/// @details The inherited index is the index of the tile holding the region origin, used for ordering
+struct RegionRequest : public IndexRequest {
+  std::vector<size_t> const
+      origin_{}, ///< Region origin, global position in the file
+      extent_{}; ///< Region extent
+
+  /// @brief Region request constructor
+  /// @param origin Region origin, global position in the file
+  /// @param extent Region extent
+  /// @param index Index of the tile holding the region origin
+  /// @param level Region pyramidal level
+  RegionRequest(std::vector<size_t> origin, std::vector<size_t> extent, std::vector<size_t> index, size_t const &level)
+      : IndexRequest(std::move(index), level), origin_(std::move(origin)), extent_(std::move(extent)) {}
+
+  /// @brief Default destructor
+  ~RegionRequest() override = default;
+
+  /// @brief Stream output operator
+  /// @param os Input stream
+  /// @param request Request to print
+  /// @return Output stream with request data
+  friend std::ostream &operator<<(std::ostream &os, RegionRequest const &request) {
+    os << "Region request origin [";
+    std::copy(request.origin_.cbegin(), request.origin_.cend(), std::ostream_iterator<size_t>(os, ", "));
+    os << "] extent [";
+    std::copy(request.extent_.cbegin(), request.extent_.cend(), std::ostream_iterator<size_t>(os, ", "));
+    os << "] level: " << request.level_;
+    return os;
+  }
+};
+}
+#endif //FAST_LOADER_REGION_REQUEST_H
@@ -0,0 +1,122 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_REQUEST_HANDLE_H
+#define FAST_LOADER_REQUEST_HANDLE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/// @brief FastLoader namespace
+namespace fl {
+
+/// @brief Handle returned when a view is requested, to cancel the request while it is pending
+/// @details A cancelled request is dropped if it has not entered the graph yet. Otherwise its tile requests not started
+/// yet are dropped, the tiles being loaded still populate the cache, and the partially filled view is returned to the
+/// memory manager instead of being sent. The request is cancelled or delivered by a single atomic transition, so a
+/// request can not be cancelled once its view is being sent.
+class RequestHandle {
+ private:
+  /// @brief State of the request
+  enum class State : uint8_t {
+    PENDING, ///< Neither cancelled nor delivered
+    CANCELLED, ///< Cancelled, not dropped yet
+    DELIVERED, ///< The view is being sent or has been sent
+    DROPPED ///< Cancelled and dropped
+  };
+
+  size_t const level_{}; ///< Pyramidal level of the request
+  std::vector<size_t> const
+      origin_{}, ///< Origin of the region covered by the request (central tile or region), global position
+      extent_{}; ///< Extent of the region covered by the request
+  std::atomic<State> state_{State::PENDING}; ///< State of the request
+
+ public:
+  /// @brief Request handle constructor
+  /// @param level Pyramidal level of the request
+  /// @param origin Origin of the region covered by the request, global position
+  /// @param extent Extent of the region covered by the request
+  RequestHandle(size_t level, std::vector<size_t> origin, std::vector<size_t> extent)
+      : level_(level), origin_(std::move(origin)), extent_(std::move(extent)) {}
+
+  /// @brief Default destructor
+  virtual ~RequestHandle() = default;
+
+  /// @brief Cancel the request
+  /// @return True if the request has been cancelled, false if it was already cancelled or its view is being sent
+  bool cancel() {
+    State pending = State::PENDING;
+    return state_.compare_exchange_strong(pending, State::CANCELLED);
+  }
+
+  /// @brief Cancelled flag accessor
+  /// @return True if the request has been cancelled
+  [[nodiscard]] bool cancelled() const {
+    auto const state = state_.load();
+    return state == State::CANCELLED || state == State::DROPPED;
+  }
+  /// @brief Done flag accessor
+  /// @return True once the view is being sent, or dropped if cancelled
+  [[nodiscard]] bool done() const {
+    auto const state = state_.load();
+    return state == State::DELIVERED || state == State::DROPPED;
+  }
+  /// @brief Pyramidal level accessor
+  /// @return Pyramidal level of the request
+  [[nodiscard]] size_t level() const { return level_; }
+  /// @brief Origin accessor
+  /// @return Origin of the region covered by the request
+  [[nodiscard]] std::vector<size_t> const &origin() const { return origin_; }
+  /// @brief Extent accessor
+  /// @return Extent of the region covered by the request
+  [[nodiscard]] std::vector<size_t> const &extent() const { return extent_; }
+
+  /// @brief Test if the request covers a part of a region
+  /// @param origin Region origin, global position
+  /// @param extent Region extent
+  /// @return True if the region covered by the request intersects the region
+  [[nodiscard]] bool intersects(std::vector<size_t> const &origin, std::vector<size_t> const &extent) const {
+    if (origin.size() != origin_.size() || extent.size() != extent_.size()) { return false; }
+    for (size_t dim = 0; dim < origin_.size(); ++dim) {
+      if (origin.at(dim) >= origin_.at(dim) + extent_.at(dim) || origin_.at(dim) >= origin.at(dim) + extent.at(dim)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// @brief Set the request as delivered, or as dropped if it has been cancelled, called by the graph before sending
+  /// the view
+  /// @return True if the view should be sent, false if the request has been cancelled
+  bool deliver() {
+    State pending = State::PENDING;
+    if (state_.compare_exchange_strong(pending, State::DELIVERED) || pending == State::DELIVERED) { return true; }
+    state_ = State::DROPPED;
+    return false;
+  }
+
+  /// @brief Set a cancelled request as dropped, called by the graph when the request is dropped
+  void drop() { state_ = State::DROPPED; }
+};
+
+} // fl
+
+#endif //FAST_LOADER_REQUEST_HANDLE_H
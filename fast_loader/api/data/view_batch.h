@@ -0,0 +1,61 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_VIEW_BATCH_H
+#define FAST_LOADER_VIEW_BATCH_H
+
+#include "../view/batched_view.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+
+/// @brief Batch of BatchedViews sharing a contiguous buffer [size, viewDims...], returned by
+/// FastLoaderGraph::getBlockingBatch
+/// @tparam DataType Type of data inside the views
+template<class DataType>
+class ViewBatch {
+ private:
+  std::vector<std::shared_ptr<BatchedView<DataType>>> const views_{}; ///< Views of the batch ordered by slot
+
+ public:
+  /// @brief ViewBatch constructor
+  /// @param views Views of the batch ordered by slot
+  explicit ViewBatch(std::vector<std::shared_ptr<BatchedView<DataType>>> views) : views_(std::move(views)) {}
+
+  /// @brief Views accessor
+  /// @return Views of the batch ordered by slot
+  [[nodiscard]] std::vector<std::shared_ptr<BatchedView<DataType>>> const &views() const { return views_; }
+  /// @brief Number of views in the batch accessor
+  /// @return Number of views in the batch
+  [[nodiscard]] size_t size() const { return views_.size(); }
+  /// @brief Batch data accessor
+  /// @return Pointer to the first element of the batch
+  [[nodiscard]] DataType *data() const { return views_.front()->batchData(); }
+  /// @brief View dimensions accessor
+  /// @return Dimensions of each view in the batch
+  [[nodiscard]] std::vector<size_t> const &viewDims() const { return views_.front()->viewDims(); }
+
+  /// @brief Return all the views of the batch to the memory manager, the buffer is reused once all views are returned
+  void returnToMemoryManager() {
+    for (auto &view : views_) { view->returnToMemoryManager(); }
+  }
+};
+
+} // fl
+
+#endif //FAST_LOADER_VIEW_BATCH_H
@@ -21,10 +21,16 @@
 
 #include <hedgehog/hedgehog.h>
 
+#include <atomic>
+#include <functional>
 #include <utility>
 
+#include "../data/tile_buffer.h"
 #include "../../core/data/tile_request.h"
 #include "../../core/cache.h"
+#include "../../core/level_thread_limiter.h"
+#include "../../core/loader_auto_tuner.h"
+#include "../../core/task/copy_physical_to_view.h"
 
 /// @brief FastLoader namespace
 namespace fl {
@@ -71,14 +77,43 @@ class AbstractTileLoader
   std::shared_ptr<internal::Cache<DataType>>
       cache_ = {}; ///< Tile Cache used by the tile loader
 
+  std::shared_ptr<internal::NumaTopology>
+      numaTopology_ = {}; ///< NUMA topology used to place the tile loader threads, nullptr if not NUMA aware
+
+  std::shared_ptr<std::atomic<size_t>>
+      nbLiveLoads_ = std::make_shared<std::atomic<size_t>>(0); ///< Number of live requests processed, shared by copies
+
+  std::shared_ptr<std::function<void()>>
+      pipelineIdleListener_ = std::make_shared<std::function<void()>>(); ///< Called when the last live request has
+                                                                        ///< been processed, shared by copies
+
+  std::shared_ptr<internal::LevelThreadLimiter>
+      threadLimiter_ = {}; ///< Limiter of the threads loading tiles per level, shared by copies, nullptr if not used
+
+  std::shared_ptr<internal::LevelThreadLimiter>
+      copyLimiter_ = {}, ///< Cap on the copies run by the tile loader threads, nullptr if the copy task copies
+      copyThreadLimiter_ = {}; ///< Limiter of the threads copying per level when the tile loader copies, can be nullptr
+
+  std::shared_ptr<internal::LoaderAutoTuner>
+      autoTuner_ = {}; ///< Controller of the number of threads loading at a time, shared by copies, nullptr if not used
+
   std::chrono::nanoseconds
       fileLoadingTime_ = std::chrono::nanoseconds::zero(); ///< Loading data from file duration
 
+  std::vector<size_t> index_{}; ///< Index of the requested tile, reused by the requests processed by the thread
+
  protected:
   std::filesystem::path const filePath_; ///< File path
   std::shared_ptr<std::unordered_map<std::string, std::string>>
       metadata_ = std::make_shared<std::unordered_map<std::string, std::string>>(); ///< Metadata representation
 
+  /// @brief Cache accessor for a level, to load tiles from another level through the caches
+  /// @param level Pyramidal level
+  /// @return Cache for the level
+  [[nodiscard]] std::shared_ptr<internal::Cache<DataType>> const &cache(size_t level) const {
+    return allCaches_->at(level);
+  }
+
  public:
   /// @brief Tile loader abstraction constructor
   /// @param name Name of the tile loader
@@ -96,14 +131,19 @@ class AbstractTileLoader
   /// @brief Default destructor
   ~AbstractTileLoader() = default;
 
+  /// @brief Test if tiles are being acquired for live requests by this tile loader or any of its copies
+  /// @return True if at least a live request is being processed
+  [[nodiscard]] bool loadingLiveRequests() const { return *nbLiveLoads_ > 0; }
+
   /// @brief File path accessor
   /// @return The file path
   [[nodiscard]] std::filesystem::path const &filePath() const { return filePath_; }
 
-  /// @brief Initialize the Tile loader to set the correct cache for the level it will act with and call user-defined
-  /// initialization
+  /// @brief Initialize the Tile loader to set the correct cache for the level it will act with, pin the thread on a
+  /// NUMA node if NUMA aware, and call user-defined initialization
   void initialize() final {
     cache_ = allCaches_->at(this->graphId());
+    if (numaTopology_) { numaTopology_->pinCurrentThread(); }
     initializeTileLoader();
   }
 
@@ -112,35 +152,70 @@ class AbstractTileLoader
 
   /// @brief Tile loader main logic
   /// @details Acquire the tile out of the cache.
-  /// If the cached tile is new, load it from the file using loadTileFromFile.
-  /// Once filled, data from the cached tile are copied to the view.
+  /// If the cached tile is new, restore it from the compressed or persistent cache tiers if used and available, else
+  /// load it from the file using loadTileFromFile and save it to the persistent cache tier if used.
+  /// Once filled, data from the cached tile are copied to the view, by the tile loader itself if it copies
+  /// (FastLoaderConfiguration::copyInTileLoader), else by the copy task.
   /// @param tileRequestData Tile request
   void execute(std::shared_ptr<internal::TileRequest<ViewType>> tileRequestData) final {
+    // The request of the view has been cancelled, the tile is not loaded and the view is not filled
+    if (tileRequestData->view()->viewData()->cancelled()) {
+      this->addResult(
+          std::make_shared<std::pair<std::shared_ptr<internal::TileRequest<ViewType>>,
+                                     std::shared_ptr<internal::CachedTile<typename ViewType::data_t>>>>(
+              tileRequestData, nullptr));
+      return;
+    }
+    ++(*nbLiveLoads_);
     std::shared_ptr<internal::CachedTile<DataType>> cachedTile;
-    auto index = tileRequestData->index();
+    index_.assign(tileRequestData->index().cbegin(), tileRequestData->index().cend());
     // Get the tile from the cache
-    cachedTile = cache_->lockedTile(index);
+    cachedTile = cache_->lockedTile(index_, tileRequestData->view()->viewData()->noCache());
     
     cachedTile->lock();
 
     //If new load from user interface
     if (cachedTile->newTile()) {
       cachedTile->newTile(false);
-      auto begin = std::chrono::system_clock::now();
-      loadTileFromFile(cachedTile->data(), index, tileRequestData->view()->level());
-      auto end = std::chrono::system_clock::now();
-      fileLoadingTime_ += std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
+      // The slots are taken once the tile is held, so they are never held while waiting for a tile in use, and the
+      // cache hits do not take any. A thread parked by the auto-tuner does not hold a level slot.
+      if (autoTuner_) { autoTuner_->acquire(); }
+      if (threadLimiter_) { threadLimiter_->acquire(this->graphId()); }
+      auto const beginLoad = std::chrono::steady_clock::now();
+      if (!cache_->restoreTile(cachedTile)) {
+        auto begin = std::chrono::system_clock::now();
+        loadTileFromFile(cachedTile->data(), index_, tileRequestData->view()->level());
+        auto end = std::chrono::system_clock::now();
+        fileLoadingTime_ += std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
+        cache_->saveTile(cachedTile);
+      }
+      if (threadLimiter_) { threadLimiter_->release(this->graphId()); }
+      if (autoTuner_) { autoTuner_->release(std::chrono::steady_clock::now() - beginLoad); }
     }
-        
-    this->addResult(
-        std::make_shared<std::pair<std::shared_ptr<internal::TileRequest<ViewType>>,
-                                   std::shared_ptr<internal::CachedTile<typename ViewType::data_t>>>>(
-            tileRequestData, cachedTile
-        )
-    );
 
-    cachedTile->unlock(); // Unlock the tile to allow other threads to access it
+    if (copyLimiter_) {
+      // The thread goes on with the copy, a copy slot is only held for the copy and never while loading from the file
+      if (copyThreadLimiter_) { copyThreadLimiter_->acquire(this->graphId()); }
+      copyLimiter_->acquire(this->graphId());
+      internal::CopyPhysicalToView<ViewType>::copyTile(tileRequestData, cachedTile);
+      copyLimiter_->release(this->graphId());
+      if (copyThreadLimiter_) { copyThreadLimiter_->release(this->graphId()); }
+      this->addResult(
+          std::make_shared<std::pair<std::shared_ptr<internal::TileRequest<ViewType>>,
+                                     std::shared_ptr<internal::CachedTile<typename ViewType::data_t>>>>(
+              tileRequestData, nullptr));
+      cachedTile->releaseSemaphore(); // Release the semaphore to allow other tasks to access the tile
+    } else {
+      this->addResult(
+          std::make_shared<std::pair<std::shared_ptr<internal::TileRequest<ViewType>>,
+                                     std::shared_ptr<internal::CachedTile<typename ViewType::data_t>>>>(
+              tileRequestData, cachedTile
+          )
+      );
+    }
 
+    cachedTile->unlock(); // Unlock the tile to allow other threads to access it
+    if (--(*nbLiveLoads_) == 0 && *pipelineIdleListener_) { (*pipelineIdleListener_)(); }
   }
 
   /// @brief Copy the TileLoader by calling user-defined copyTileLoader method and setting the caches
@@ -153,6 +228,13 @@ class AbstractTileLoader
     if (tileLoader) {
       tileLoader->metadata_ = this->metadata_;
       tileLoader->allCaches_ = this->allCaches_;
+      tileLoader->numaTopology_ = this->numaTopology_;
+      tileLoader->nbLiveLoads_ = this->nbLiveLoads_;
+      tileLoader->pipelineIdleListener_ = this->pipelineIdleListener_;
+      tileLoader->threadLimiter_ = this->threadLimiter_;
+      tileLoader->copyLimiter_ = this->copyLimiter_;
+      tileLoader->copyThreadLimiter_ = this->copyThreadLimiter_;
+      tileLoader->autoTuner_ = this->autoTuner_;
       return tileLoader;
     } else {
       throw (std::runtime_error("The copyTileLoader method redefined for the tile loader return a non valid TileLoader."));
@@ -170,6 +252,22 @@ class AbstractTileLoader
         << "File Loading time: " << durationPrinter(fileLoadingTime_) << std::endl
         << "Cache Access time: " << durationPrinter(cache_->accessTime()) << std::endl
         << "Cache Recycle time: " << durationPrinter(cache_->recycleTime()) << std::endl;
+    if (cache_->declined() > 0) {
+      oss << "Cache tiles not admitted: " << cache_->declined() << " / " << cache_->miss() << std::endl;
+    }
+    if (auto const &compressedCache = cache_->compressedCache()) {
+      oss << "Compressed cache miss rate: "
+          << (double) (compressedCache->miss()) / (double) (compressedCache->miss() + compressedCache->hit()) * 100
+          << "%" << std::endl
+          << "Compressed cache size: " << (double) compressedCache->nbBytes() / (double) (1024 * 1024) << "MB ("
+          << compressedCache->nbTiles() << " tiles, ratio " << compressedCache->compressionRatio() << ")"
+          << std::endl;
+    }
+    if (auto const &diskCache = cache_->diskCache(); diskCache && diskCache->enabled()) {
+      oss << "Disk cache miss rate: "
+          << (double) (diskCache->miss()) / (double) (diskCache->miss() + diskCache->hit()) * 100 << "%"
+          << " (" << diskCache->nbTiles() << " tiles)" << std::endl;
+    }
     return oss.str();
   }
 
@@ -245,10 +343,10 @@ class AbstractTileLoader
   /// @brief Load a tile from the file.
   /// @details Provide an allocated buffer and the position of the requested tile. The aim of this interface is to fill
   /// the buffer from data from the file.
-  /// @param tile Allocated buffer to fill
+  /// @param tile Allocated buffer to fill, from the buffer allocator of the configuration
   /// @param index Position of the tile
   /// @param level Level of the tile
-  virtual void loadTileFromFile(std::shared_ptr<std::vector<DataType>> tile,
+  virtual void loadTileFromFile(std::shared_ptr<TileBuffer<DataType>> tile,
                                 std::vector<size_t> const &index,
                                 size_t level) = 0;
 
@@ -20,13 +20,13 @@
 #define FAST_LOADER_ADAPTIVE_FAST_LOADER_GRAPH_H
 
 #include <utility>
+#include <limits>
 
 #include "../fast_loader_graph.h"
 #include "../../../core/task/mapper_logical_physical.h"
 #include "../../../core/task/copy_logical_tile_to_view.h"
 #include "../../../core/state/direct_to_copy_state.h"
 #include "../../../core/state/to_tile_loader_state.h"
-#include "../../../core/state/tile_loader_counter_state.h"
 
 
 /// @brief FastLoader namespace
@@ -36,6 +36,7 @@ namespace fl {
 /// Works exactly the same way as the FastLoaderGraph but requires the new tile dimensions for all levels:
 /// -# logicalTileDimensionRequestedPerDimensionPerLevel: dimensions of the tiles for all levels {{d00, ..,, d0n}, ..., {dm0, ..., dmn}} for n dimensions tiles with m levels
 /// -# nbLogicalTilesCachePerLevel: Cache size used  for the transformation between physical tiles to requested tiles for every level
+/// The logical tile dimensions can also be selected from a target number of views (selectLogicalTileDimensions).
 /// @tparam ViewType Type of the view
 template<class ViewType>
 class AdaptiveFastLoaderGraph : public fl::FastLoaderGraph<ViewType> {
@@ -47,6 +48,7 @@ class AdaptiveFastLoaderGraph : public fl::FastLoaderGraph<ViewType> {
   std::shared_ptr<std::vector<size_t>> logicalTileCacheMBPerLevel_{}; ///< Logical tile cache size for every level
   std::vector<std::vector<size_t>> const
       logicalTileDimensionRequestedPerDimensionPerLevel_{}; ///< Logical tile dimensions requested per dimension per level
+  bool logicalCacheUsed_ = true; ///< False if the views are filled straight from the physical tiles
 
  public:
   /// @brief Adaptive Fast Loader graph constructor
@@ -80,6 +82,7 @@ class AdaptiveFastLoaderGraph : public fl::FastLoaderGraph<ViewType> {
     this->tileLoader_ = this->configuration_->tileLoader_;
     this->nbDimensions_ = this->tileLoader_->nbDims();
     this->nbPyramidLevels_ = this->tileLoader_->nbPyramidLevels();
+    this->setupNuma();
 
     validateInputs(logicalTileDimensionRequestedPerDimensionPerLevel_);
     if (nbThreadsCopyLogicalCacheView == 0) { nbThreadsCopyLogicalCacheView = 2; }
@@ -92,6 +95,18 @@ class AdaptiveFastLoaderGraph : public fl::FastLoaderGraph<ViewType> {
     tileLoaderAllCaches->reserve(this->nbPyramidLevels_);
     allAdaptiveCaches->reserve(this->nbPyramidLevels_);
 
+    // The logical tile cache is only needed if the logical and physical tiles are misaligned, i.e. if for a dimension
+    // the logical tile dimension is neither a multiple nor a divisor of the physical tile dimension
+    logicalCacheUsed_ = false;
+    for (size_t level = 0; level < this->nbPyramidLevels_; ++level) {
+      auto const &logicalTileDimension = logicalTileDimensionRequestedPerDimensionPerLevel_.at(level);
+      auto const &physicalTileDimension = this->tileLoader_->tileDims(level);
+      for (size_t dim = 0; dim < this->nbDimensions_; ++dim) {
+        logicalCacheUsed_ |= logicalTileDimension.at(dim) % physicalTileDimension.at(dim) != 0
+            && physicalTileDimension.at(dim) % logicalTileDimension.at(dim) != 0;
+      }
+    }
+
     std::vector<size_t> tmpDimension;
     for (size_t level = 0; level < this->nbPyramidLevels_; ++level) {
       this->fullDimensionPerLevel_->push_back(this->tileLoader_->fullDims(level));
@@ -138,30 +153,51 @@ class AdaptiveFastLoaderGraph : public fl::FastLoaderGraph<ViewType> {
                   (double) 1,
                   (double) (this->configuration_->cacheCapacityMB().at(level)) / sizePhysicalTileMB
               ),
-              physicalTileDimensionPerLevel_->at(level)
+              physicalTileDimensionPerLevel_->at(level),
+              this->configuration_->bufferAllocator_,
+              this->numaTopology_,
+              this->compressedCache(level),
+              this->diskCache(level, physicalTileDimensionPerLevel_->at(level)),
+              (size_t) ((double) (this->configuration_->pinnedCapacityMB().at(level)) / sizePhysicalTileMB),
+              this->configuration_->cacheAdmissionType_
           )
       );
       tmpDimension.clear();
 
       // Adaptive cache
-      allAdaptiveCaches->push_back(
-          std::make_shared<internal::Cache<DataType>>(
-              this->nbTilesDims(level),
-              (size_t) std::max(
-                  (double) 1,
-                  (double) (logicalTileCacheMBPerLevel_->at(level)) / sizeLogicalTileMB
-              ),
-              this->tileDimensionPerLevel_->at(level)
-          )
-      );
+      if (logicalCacheUsed_) {
+        allAdaptiveCaches->push_back(
+            std::make_shared<internal::Cache<DataType>>(
+                this->nbTilesDims(level),
+                (size_t) std::max(
+                    (double) 1,
+                    (double) (logicalTileCacheMBPerLevel_->at(level)) / sizeLogicalTileMB
+                ),
+                this->tileDimensionPerLevel_->at(level),
+                this->configuration_->bufferAllocator_,
+                this->numaTopology_
+            )
+        );
+      }
     }
     this->tileLoader_->allCaches_ = tileLoaderAllCaches;
+    this->tileLoader_->threadLimiter_ = this->createLevelThreadLimiter(
+        this->configuration_->nbThreadsTileLoaderPerLevel_, this->configuration_->nbThreadsTileLoaderShared_);
+    this->tileLoader_->copyLimiter_ = this->createTileLoaderCopyLimiter();
+    this->tileLoader_->autoTuner_ = this->createLoaderAutoTuner();
+    auto copyThreadLimiter = this->createLevelThreadLimiter(
+        this->configuration_->nbThreadsCopyPerLevel_, this->configuration_->nbThreadsCopyShared_);
+    if (this->tileLoader_->copyLimiter_) { this->tileLoader_->copyThreadLimiter_ = copyThreadLimiter; }
 
     // Tasks
+    this->createRequestScheduler();
     auto viewCounter =
         std::make_shared<internal::ViewCounter<ViewType>>(this->configuration_->borderCreator_,
-                                                          this->configuration_->ordered_);
-    auto cpyPhysicalToView = std::make_shared<internal::CopyPhysicalToView<ViewType>>(this->configuration_->nbThreadsCopyPhysicalCacheView());
+                                                          this->configuration_->ordered_,
+                                                          this->requestScheduler_,
+                                                          this->configuration_->coalesceRequests_);
+    auto cpyPhysicalToView = std::make_shared<internal::CopyPhysicalToView<ViewType>>(
+        this->nbThreadsCopy(), this->numaTopology_, copyThreadLimiter);
     // Internal graph
     this->levelGraph_ =
         std::make_shared<hh::Graph<1, IndexRequest, internal::TileRequest<ViewType>>>("Fast Loader Level");
@@ -176,56 +212,59 @@ class AdaptiveFastLoaderGraph : public fl::FastLoaderGraph<ViewType> {
           this->fullDimensionPerLevel_, this->tileDimensionPerLevel_, this->radii(), this->tileLoader_->dimNames()
       );
 
-      auto mm = std::make_shared<internal::FastLoaderMemoryManager<ViewDataType>>(
-          this->configuration_->viewAvailablePerLevel_,
-          sizeMemoryManagerPerLevel,
-          this->configuration_->nbReleasePyramid_);
-
-      auto viewLoader =
-          std::make_shared<internal::ViewLoader<ViewType, ViewDataType>>(this->configuration_->borderCreator_);
-
-      auto mapperLogicalPhysical = std::make_shared<internal::MapperLogicalPhysical<ViewType>>(
-          this->physicalTileDimensionPerLevel_, this->tileDimensionPerLevel_, this->fullDimensionPerLevel_,
-          allAdaptiveCaches, this->tileLoader_->dimNames()
-      );
-
-      auto directToCopyStateManager = std::make_shared<
-          hh::StateManager<
-              1, fl::internal::AdaptiveTileRequest<ViewType>, fl::internal::AdaptiveTileRequest<ViewType>
-          >
-      >(std::make_shared<internal::DirectToCopyState<ViewType>>(), "Direct to copy");
-
-      auto copyLogicalTileToView = std::make_shared<fl::internal::CopyLogicalTileToView<ViewType>>(
-          nbThreadsCopyLogicalCacheView
-      );
-
-      auto toTLStateManager = std::make_shared<
-          hh::StateManager<1, fl::internal::AdaptiveTileRequest<ViewType>, fl::internal::TileRequest<ViewType>>>
-          (std::make_shared<fl::internal::ToTileLoaderState<ViewType>>(), "To TL");
-
-      auto tlCounterStateManager = std::make_shared<
-          hh::StateManager<1, fl::internal::TileRequest<ViewType>, fl::internal::AdaptiveTileRequest<ViewType>>>
-          (std::make_shared<fl::internal::TileLoaderCounterState<ViewType>>(), "Counter SM");
+      auto mm = this->template createMemoryManager<ViewDataType>(sizeMemoryManagerPerLevel);
 
       viewWaiter->connectMemoryManager(mm);
       this->levelGraph_->inputs(viewWaiter);
-      this->levelGraph_->edges(viewWaiter, viewLoader);
-
-      this->levelGraph_->edges(viewLoader, mapperLogicalPhysical);
-      // Direct Copy if cache found
-      this->levelGraph_->edges(mapperLogicalPhysical, directToCopyStateManager);
-      this->levelGraph_->edges(directToCopyStateManager, copyLogicalTileToView);
 
-
-      //Route with tileLoader
-      this->levelGraph_->edges(mapperLogicalPhysical, toTLStateManager);
-      this->levelGraph_->edges(toTLStateManager, this->tileLoader_);
-      this->levelGraph_->edges(this->tileLoader_, cpyPhysicalToView);
-      this->levelGraph_->edges(cpyPhysicalToView, tlCounterStateManager);
-      this->levelGraph_->edges(tlCounterStateManager, copyLogicalTileToView);
-
-      // Output
-      this->levelGraph_->outputs(copyLogicalTileToView);
+      if (!logicalCacheUsed_) {
+        // The copies go straight from the physical tiles to the views
+        auto viewLoader = std::make_shared<internal::ViewLoader<ViewType, ViewDataType>>(
+            this->configuration_->borderCreator_, physicalTileDimensionPerLevel_);
+        this->levelGraph_->edges(viewWaiter, viewLoader);
+        this->levelGraph_->edges(viewLoader, this->tileLoader_);
+        this->levelGraph_->edges(this->tileLoader_, cpyPhysicalToView);
+        this->levelGraph_->outputs(cpyPhysicalToView);
+      } else {
+        auto viewLoader =
+            std::make_shared<internal::ViewLoader<ViewType, ViewDataType>>(this->configuration_->borderCreator_);
+
+        auto mapperLogicalPhysical = std::make_shared<internal::MapperLogicalPhysical<ViewType>>(
+            this->physicalTileDimensionPerLevel_, this->tileDimensionPerLevel_, this->fullDimensionPerLevel_,
+            allAdaptiveCaches, this->tileLoader_->dimNames()
+        );
+
+        auto directToCopyStateManager = std::make_shared<
+            hh::StateManager<
+                1, fl::internal::AdaptiveTileRequest<ViewType>, fl::internal::AdaptiveTileRequest<ViewType>
+            >
+        >(std::make_shared<internal::DirectToCopyState<ViewType>>(), "Direct to copy");
+
+        auto copyLogicalTileToView = std::make_shared<fl::internal::CopyLogicalTileToView<ViewType>>(
+            nbThreadsCopyLogicalCacheView
+        );
+
+        auto toTLStateManager = std::make_shared<
+            hh::StateManager<1, fl::internal::AdaptiveTileRequest<ViewType>, fl::internal::TileRequest<ViewType>>>
+            (std::make_shared<fl::internal::ToTileLoaderState<ViewType>>(), "To TL");
+
+        this->levelGraph_->edges(viewWaiter, viewLoader);
+
+        this->levelGraph_->edges(viewLoader, mapperLogicalPhysical);
+        // Direct Copy if cache found
+        this->levelGraph_->edges(mapperLogicalPhysical, directToCopyStateManager);
+        this->levelGraph_->edges(directToCopyStateManager, copyLogicalTileToView);
+
+
+        //Route with tileLoader
+        this->levelGraph_->edges(mapperLogicalPhysical, toTLStateManager);
+        this->levelGraph_->edges(toTLStateManager, this->tileLoader_);
+        this->levelGraph_->edges(this->tileLoader_, cpyPhysicalToView);
+        this->levelGraph_->edges(cpyPhysicalToView, copyLogicalTileToView);
+
+        // Output
+        this->levelGraph_->outputs(copyLogicalTileToView);
+      }
 
     }
 #ifdef HH_USE_CUDA
@@ -238,55 +277,58 @@ class AdaptiveFastLoaderGraph : public fl::FastLoaderGraph<ViewType> {
           this->fullDimensionPerLevel_, this->tileDimensionPerLevel_, this->radii(), this->tileLoader_->dimNames()
       );
 
-      auto mm = std::make_shared<internal::FastLoaderMemoryManager<ViewDataType>>(
-          this->configuration_->viewAvailablePerLevel_,
-          sizeMemoryManagerPerLevel,
-          this->configuration_->nbReleasePyramid_);
-
-      auto viewLoader =
-          std::make_shared<internal::ViewLoader<ViewType, ViewDataType>>(this->configuration_->borderCreator_);
-
-      auto mapperLogicalPhysical = std::make_shared<internal::MapperLogicalPhysical<ViewType>>(
-          this->physicalTileDimensionPerLevel_, this->tileDimensionPerLevel_, this->fullDimensionPerLevel_,
-          this->nbLogicalTileCachePerLevel_, allAdaptiveCaches, this->tileLoader_->dimNames()
-      );
-
-      auto directToCopyStateManager = std::make_shared<
-          hh::StateManager<
-              1, fl::internal::AdaptiveTileRequest<ViewType>, fl::internal::AdaptiveTileRequest<ViewType>
-          >
-      >(std::make_shared<internal::DirectToCopyState<ViewType>>());
-
-      auto copyLogicalTileToView = std::make_shared<fl::internal::CopyLogicalTileToView<ViewType>>(
-          nbThreadsCopyLogicalCacheView);
-
-      auto toTLStateManager = std::make_shared<
-          hh::StateManager<1, fl::internal::AdaptiveTileRequest<ViewType>, fl::internal::TileRequest<ViewType>>>
-          (std::make_shared<fl::internal::ToTileLoaderState<ViewType>>(), "To TL SM");
-
-      auto tlCounterStateManager = std::make_shared<
-          hh::StateManager<1, fl::internal::TileRequest<ViewType>, fl::internal::AdaptiveTileRequest<ViewType>>>
-          (std::make_shared<fl::internal::TileLoaderCounterState<ViewType>>(), "Counter SM");
+      auto mm = this->template createMemoryManager<ViewDataType>(sizeMemoryManagerPerLevel);
 
       viewWaiter->connectMemoryManager(mm);
       this->levelGraph_->inputs(viewWaiter);
-      this->levelGraph_->edges(viewWaiter, viewLoader);
-
-      this->levelGraph_->edges(viewLoader, mapperLogicalPhysical);
-      // Direct Copy if cache found
-      this->levelGraph_->edges(mapperLogicalPhysical, directToCopyStateManager);
-      this->levelGraph_->edges(directToCopyStateManager, copyLogicalTileToView);
 
-
-      //Route with tileLoader
-      this->levelGraph_->edges(mapperLogicalPhysical, toTLStateManager);
-      this->levelGraph_->edges(toTLStateManager, this->tileLoader_);
-      this->levelGraph_->edges(this->tileLoader_, cpyPhysicalToView);
-      this->levelGraph_->edges(cpyPhysicalToView, tlCounterStateManager);
-      this->levelGraph_->edges(tlCounterStateManager, copyLogicalTileToView);
-
-      // Output
-      this->levelGraph_->outputs(copyLogicalTileToView);
+      if (!logicalCacheUsed_) {
+        // The copies go straight from the physical tiles to the views
+        auto viewLoader = std::make_shared<internal::ViewLoader<ViewType, ViewDataType>>(
+            this->configuration_->borderCreator_, physicalTileDimensionPerLevel_);
+        this->levelGraph_->edges(viewWaiter, viewLoader);
+        this->levelGraph_->edges(viewLoader, this->tileLoader_);
+        this->levelGraph_->edges(this->tileLoader_, cpyPhysicalToView);
+        this->levelGraph_->outputs(cpyPhysicalToView);
+      } else {
+        auto viewLoader =
+            std::make_shared<internal::ViewLoader<ViewType, ViewDataType>>(this->configuration_->borderCreator_);
+
+        auto mapperLogicalPhysical = std::make_shared<internal::MapperLogicalPhysical<ViewType>>(
+            this->physicalTileDimensionPerLevel_, this->tileDimensionPerLevel_, this->fullDimensionPerLevel_,
+            this->nbLogicalTileCachePerLevel_, allAdaptiveCaches, this->tileLoader_->dimNames()
+        );
+
+        auto directToCopyStateManager = std::make_shared<
+            hh::StateManager<
+                1, fl::internal::AdaptiveTileRequest<ViewType>, fl::internal::AdaptiveTileRequest<ViewType>
+            >
+        >(std::make_shared<internal::DirectToCopyState<ViewType>>());
+
+        auto copyLogicalTileToView = std::make_shared<fl::internal::CopyLogicalTileToView<ViewType>>(
+            nbThreadsCopyLogicalCacheView);
+
+        auto toTLStateManager = std::make_shared<
+            hh::StateManager<1, fl::internal::AdaptiveTileRequest<ViewType>, fl::internal::TileRequest<ViewType>>>
+            (std::make_shared<fl::internal::ToTileLoaderState<ViewType>>(), "To TL SM");
+
+        this->levelGraph_->edges(viewWaiter, viewLoader);
+
+        this->levelGraph_->edges(viewLoader, mapperLogicalPhysical);
+        // Direct Copy if cache found
+        this->levelGraph_->edges(mapperLogicalPhysical, directToCopyStateManager);
+        this->levelGraph_->edges(directToCopyStateManager, copyLogicalTileToView);
+
+
+        //Route with tileLoader
+        this->levelGraph_->edges(mapperLogicalPhysical, toTLStateManager);
+        this->levelGraph_->edges(toTLStateManager, this->tileLoader_);
+        this->levelGraph_->edges(this->tileLoader_, cpyPhysicalToView);
+        this->levelGraph_->edges(cpyPhysicalToView, copyLogicalTileToView);
+
+        // Output
+        this->levelGraph_->outputs(copyLogicalTileToView);
+      }
 
     }
 #endif // HH_USE_CUDA
@@ -302,11 +344,123 @@ class AdaptiveFastLoaderGraph : public fl::FastLoaderGraph<ViewType> {
     this->inputs(levelExecutionPipeline);
     this->edges(levelExecutionPipeline, viewCounter);
     this->outputs(viewCounter);
+    this->startWarmStart();
   }
 
+  /// @brief Adaptive Fast Loader graph constructor selecting the logical tile dimensions
+  /// @details The logical tile dimensions are selected with selectLogicalTileDimensions, and can be retrieved with
+  /// logicalTileDims
+  /// @param configuration Fast Loader graph configuration
+  /// @param nbViewsTarget Number of views expected to be processed at the same time
+  /// @param logicalTileCacheMBPerLevel Cache size in MB used  for the transformation between physical tiles to requested tiles for every level
+  /// @param nbThreadsCopyLogicalCacheView Number of threads associated with the copy from the logical cache to view task
+  /// @param name Fast Loader graph name
+  AdaptiveFastLoaderGraph(
+      std::unique_ptr<FastLoaderConfiguration<ViewType>> configuration,
+      size_t nbViewsTarget,
+      std::vector<size_t> logicalTileCacheMBPerLevel = {},
+      size_t nbThreadsCopyLogicalCacheView = 2,
+      std::string const &name = "Adaptive Tile Loader")
+      : AdaptiveFastLoaderGraph(
+      withSelectedLogicalTileDimensions(std::move(configuration), nbViewsTarget),
+      std::move(logicalTileCacheMBPerLevel), nbThreadsCopyLogicalCacheView, name) {}
+
   /// @brief Default destructor
   ~AdaptiveFastLoaderGraph() override = default;
 
+  /// @brief Logical tile dimensions accessor for a level
+  /// @param level Pyramidal Level
+  /// @return Logical tile dimensions for a level
+  [[nodiscard]] std::vector<size_t> const &logicalTileDims(std::size_t const level = 0) const {
+    return this->tileDimensionPerLevel_->at(level);
+  }
+
+  /// @brief Select for each level logical tile dimensions aligned on the physical tiles (multiple or divisor)
+  /// @details The selection minimizes an estimation of the number of elements read from the file and copied per view
+  /// element:
+  /// - copied: the view elements (tile + radii) per tile element, which decreases with the tile size
+  /// - read: one per element if the physical tiles overlapped by nbViewsTarget views fit in the physical cache,
+  /// else all the physical tiles overlapped by a view are read again for each view
+  /// A fixed cost per view favors the largest tiles. Innermost dimensions not a multiple of the SIMD width (64 bytes)
+  /// are slightly penalized.
+  /// @param configuration Fast Loader graph configuration
+  /// @param nbViewsTarget Number of views expected to be processed at the same time
+  /// @return Logical tile dimensions per level
+  /// @throw std::runtime_error If the configuration is not valid or if nbViewsTarget is equal to 0
+  static std::vector<std::vector<size_t>> selectLogicalTileDimensions(
+      FastLoaderConfiguration<ViewType> const &configuration, size_t nbViewsTarget) {
+    if (nbViewsTarget == 0) { throw std::runtime_error("The target number of views should not be equal to zero."); }
+    size_t const
+        simdWidthByte = 64,
+        maxMultiple = 32;
+    double const viewOverheadElements = 256; // Fixed cost of a view (requests, tasks), in number of elements copied
+    auto const &tileLoader = configuration.tileLoader_;
+    auto const &radii = configuration.radii_;
+    size_t const nbDimensions = tileLoader->nbDims();
+    std::vector<std::vector<size_t>> logicalTileDimensionPerLevel{};
+
+    for (size_t level = 0; level < tileLoader->nbPyramidLevels(); ++level) {
+      auto const &fullDimension = tileLoader->fullDims(level);
+      auto const &physicalTileDimension = tileLoader->tileDims(level);
+      double const cacheElements =
+          (double) configuration.cacheCapacityMB().at(level) * 1024 * 1024 / (double) sizeof(DataType);
+      double const physicalTileElements = (double) std::accumulate(
+          physicalTileDimension.cbegin(), physicalTileDimension.cend(), (size_t) 1, std::multiplies<>());
+
+      // Candidates per dimension: divisors and multiples (up to the file size, and maxMultiple) of the physical tile
+      // dimension
+      std::vector<std::vector<size_t>> candidates(nbDimensions);
+      for (size_t dim = 0; dim < nbDimensions; ++dim) {
+        size_t const physical = physicalTileDimension.at(dim);
+        size_t const nbPhysicalTiles = (fullDimension.at(dim) + physical - 1) / physical;
+        for (size_t divisor = physical; divisor > 0; --divisor) {
+          if (physical % divisor == 0) { candidates.at(dim).push_back(physical / divisor); }
+        }
+        for (size_t multiple = 2; multiple <= std::min(nbPhysicalTiles, maxMultiple); ++multiple) {
+          candidates.at(dim).push_back(physical * multiple);
+        }
+      }
+
+      std::vector<size_t> candidateId(nbDimensions, 0), logicalTileDimension(nbDimensions), best{};
+      double bestCost = std::numeric_limits<double>::max();
+      bool nextCandidate = true;
+      while (nextCandidate) {
+        double viewElements = 1, usefulElements = 1, tilesTouched = 1;
+        for (size_t dim = 0; dim < nbDimensions; ++dim) {
+          size_t const
+              tile = candidates.at(dim).at(candidateId.at(dim)),
+              physical = physicalTileDimension.at(dim),
+              radiusTiles = (radii.at(dim) + physical - 1) / physical;
+          logicalTileDimension.at(dim) = tile;
+          viewElements *= (double) (tile + 2 * radii.at(dim));
+          usefulElements *= (double) std::min(tile, fullDimension.at(dim));
+          tilesTouched *= (double) ((tile >= physical ? tile / physical : 1) + 2 * radiusTiles);
+        }
+        double const read = (double) nbViewsTarget * tilesTouched * physicalTileElements <= cacheElements
+                            ? 1 : tilesTouched * physicalTileElements / usefulElements;
+        double cost = read + (viewElements + viewOverheadElements) / usefulElements;
+        if ((logicalTileDimension.back() * sizeof(DataType)) % simdWidthByte != 0) { cost *= 1.05; }
+        if (cost < bestCost) {
+          bestCost = cost;
+          best = logicalTileDimension;
+        }
+
+        nextCandidate = false;
+        for (size_t dim = nbDimensions; dim > 0 && !nextCandidate; --dim) {
+          if (++candidateId.at(dim - 1) < candidates.at(dim - 1).size()) { nextCandidate = true; }
+          else { candidateId.at(dim - 1) = 0; }
+        }
+      }
+      logicalTileDimensionPerLevel.push_back(best);
+    }
+    return logicalTileDimensionPerLevel;
+  }
+
+  /// @brief Logical cache usage accessor
+  /// @return True if the views are built through the logical tile cache, false if the logical tiles are aligned on the
+  /// physical tiles (multiple or divisor for all dimensions) and the views are filled straight from the physical tiles
+  [[nodiscard]] bool logicalCacheUsed() const { return logicalCacheUsed_; }
+
   /// @brief Estimate the maximum memory usage used by FastLoader in bytes
   /// @return Estimate the maximum memory usage used by FastLoader in bytes
   size_t estimatedMaximumMemoryUsageMB() override {
@@ -328,7 +482,7 @@ class AdaptiveFastLoaderGraph : public fl::FastLoaderGraph<ViewType> {
 
       // Add cache size
       sum += this->configuration_->cacheCapacityMB().at(level);
-      sum += this->logicalTileCacheMBPerLevel_->at(level);
+      if (logicalCacheUsed_) { sum += this->logicalTileCacheMBPerLevel_->at(level); }
       // Add views size flowing
       sum += this->configuration_->viewAvailablePerLevel_.at(level) * logicalViewSizeMB;
     }
@@ -336,6 +490,34 @@ class AdaptiveFastLoaderGraph : public fl::FastLoaderGraph<ViewType> {
   }
 
  private:
+  /// @brief Adaptive Fast Loader graph constructor from a configuration and its selected logical tile dimensions
+  /// @param configurationAndDimensions Fast Loader graph configuration and logical tile dimensions per level
+  /// @param logicalTileCacheMBPerLevel Cache size in MB used  for the transformation between physical tiles to requested tiles for every level
+  /// @param nbThreadsCopyLogicalCacheView Number of threads associated with the copy from the logical cache to view task
+  /// @param name Fast Loader graph name
+  AdaptiveFastLoaderGraph(
+      std::pair<std::unique_ptr<FastLoaderConfiguration<ViewType>>, std::vector<std::vector<size_t>>>
+      &&configurationAndDimensions,
+      std::vector<size_t> logicalTileCacheMBPerLevel, size_t nbThreadsCopyLogicalCacheView, std::string const &name)
+      : AdaptiveFastLoaderGraph(
+      std::move(configurationAndDimensions.first), configurationAndDimensions.second,
+      std::move(logicalTileCacheMBPerLevel), nbThreadsCopyLogicalCacheView, name) {}
+
+  /// @brief Select the logical tile dimensions for a configuration
+  /// @param configuration Fast Loader graph configuration
+  /// @param nbViewsTarget Number of views expected to be processed at the same time
+  /// @return The configuration and the logical tile dimensions per level
+  /// @throw std::runtime_error If the configuration is not valid
+  static std::pair<std::unique_ptr<FastLoaderConfiguration<ViewType>>, std::vector<std::vector<size_t>>>
+  withSelectedLogicalTileDimensions(std::unique_ptr<FastLoaderConfiguration<ViewType>> configuration,
+                                    size_t nbViewsTarget) {
+    if (!configuration) {
+      throw std::runtime_error("The configuration given to FastLoaderConfiguration is not valid.");
+    }
+    auto logicalTileDimensions = selectLogicalTileDimensions(*configuration, nbViewsTarget);
+    return {std::move(configuration), std::move(logicalTileDimensions)};
+  }
+
   /// @brief Test validity of user inputs
   /// @param logicalTileDimensionRequestedPerDimensionPerLevel User defined requested dimensions of the tiles for all levels
   void validateInputs(std::vector<std::vector<size_t>> const &logicalTileDimensionRequestedPerDimensionPerLevel) {
@@ -20,6 +20,8 @@
 #define FAST_LOADER_FAST_LOADER_CONFIGURATION_H
 #include <vector>
 #include <memory>
+#include <chrono>
+#include <filesystem>
 
 #include "../../tools/traits.h"
 
@@ -27,9 +29,12 @@
 #include "options/abstract_traversal.h"
 #include "abstract_tile_loader.h"
 #include "options/abstract_border_creator.h"
+#include "options/abstract_buffer_allocator.h"
 #include "../../core/border_creator/constant_border_creator.h"
 #include "../../core/border_creator/default_border_creator.h"
 #include "../../core/traversal/naive_traversal.h"
+#include "../../core/buffer_allocator/huge_page_buffer_allocator.h"
+#include "../../core/virtual_level_tile_loader.h"
 
 /// @brief FastLoader namespace
 namespace fl {
@@ -47,11 +52,28 @@ class FastLoaderGraph;
 ///   - By calling radius(size_t sharedRadius) that define a common radius value among the dimensions
 ///   - By calling radii(std::vector<size_t> const &radii) that set different radius value for the dimensions
 /// - Define the cache capacity attached to the tie loader (cacheCapacityMB(vector<size_t> const &))
+/// - Define the capacity of the compressed cache tier holding the tiles evicted from the cache (compressedCacheCapacityMB(vector<size_t> const &))
+/// - Define the pinned budget of the cache, the capacity that can be held by tiles pinned with FastLoaderGraph::pinTiles (pinnedCapacityMB(vector<size_t> const &))
+/// - Define the admission of the missed tiles in the cache, to resist to scans (cacheAdmission(CacheAdmissionType))
+/// - Define the number of requests admitted in the graph at a time, the other ones waiting by priority (requestWindow(size_t))
+/// - Define if the duplicate requests of a view in flight are served by the same view (coalesceRequests(bool))
+/// - Define the capacity the view pools can grow to when the pipeline starves for views (elasticViewPool(vector<size_t> const &, std::chrono::milliseconds))
+/// - Define the capacity of the buffer a recycled view keeps after serving a region request (regionBufferCapacityMB(vector<size_t> const &))
+/// - Define a cache snapshot saved by a previous run to preload in the background at startup (warmStart(std::filesystem::path const &))
+/// - Define the directory and capacity of the persistent cache tier holding the tiles loaded from the file across runs (diskCache(std::filesystem::path const &, vector<size_t> const &))
 /// - Define if the views need to be given in the same order they have been requested or as soon as possible (ordered(bool))
 /// - Define the release count for the views (number of time a view need to be returned before being clean for reuse) (releaseCountPerLevel(std::vector<size_t> const &))
 /// - Define the number of views being constructed in parallel (viewAvailable(vector<size_t> const &))
 /// - Define the traversal used if all views are requested (traversalType(TraversalType) / traversalCustom(shared_ptr<TraversalType>))
 /// - Define the borderCreator used to fill the view with data not defined by the file (borderCreator(FillingType) / borderCreatorConstant(data_t) / borderCreatorCustom(shared_ptr<AbstractBorderCreator<ViewType>>))
+/// - Define the batch size and timeout when BatchedViews are used (batch(size_t, std::chrono::milliseconds))
+/// - Add pyramid levels synthesized by downsampling on top of the file levels (virtualLevels(size_t, DownsamplingType, std::vector<bool> const &)), to call before setting the options per level
+/// - Define if a preview upsampled from a cached coarser level is sent before each requested view (progressive(bool))
+/// - Define the allocation of the views and tiles buffers (bufferAllocation(BufferAllocationType) / bufferAllocatorCustom(shared_ptr<AbstractBufferAllocator>))
+/// - Define if the caches, views and threads are placed according to the NUMA topology (numaAware(bool))
+/// - Define the number of threads loading and copying tiles running at a time per level and across the levels (levelThreads(vector<size_t> const &, vector<size_t> const &) / sharedLevelThreads(size_t, size_t))
+/// - Define if the tile loader threads copy the tiles to the views, with a cap on the copies running at a time (copyInTileLoader(size_t))
+/// - Define if the number of tile loader threads loading at a time is tuned at runtime for the storage in use (autoTuneLoaderThreads(size_t, size_t, std::chrono::milliseconds))
 /// @tparam ViewType Type of the view
 template<class ViewType>
 class FastLoaderConfiguration {
@@ -60,38 +82,78 @@ class FastLoaderConfiguration {
   static_assert(std::is_default_constructible_v<ViewType>,
                 "The given type should be default constructible.");
   static_assert(internal::traits::HasDataType<ViewType>::value,
-                "The given type do not have the good properties, it should inherit from the class DefaultView or "
-                "UnifiedView if available.");
+                "The given type do not have the good properties, it should inherit from the class DefaultView, "
+                "TileAliasView, BatchedView or UnifiedView if available.");
   static_assert(std::is_arithmetic_v<typename ViewType::data_t>,
                 "The type hold by the view should be an arithmetic type.");
   static_assert(internal::traits::is_view_v<ViewType>,
-                "The given type should inherit from view (DefaultView or UnifiedView if available).");
+                "The given type should inherit from view (DefaultView, TileAliasView, BatchedView or UnifiedView if "
+                "available).");
 
   std::vector<size_t>
       nbReleasePyramid_,        ///< the number of time a view should return into the graph before being discarded and
   ///< be available to a new request
   cacheCapacityMB_,         ///< TileLoader Cache capacity in MB
+  compressedCacheCapacityMB_, ///< TileLoader compressed cache tier capacity in MB, 0 if not used
+  diskCacheCapacityMB_,     ///< TileLoader persistent cache tier capacity in MB, 0 if not used
+  pinnedCapacityMB_,        ///< TileLoader cache capacity in MB that can be pinned, 0 if pinning is disabled
+  viewPoolCapacityMB_,      ///< Capacity in MB the view pool can grow to, 0 for a static pool
+  regionBufferCapacityMB_,  ///< Capacity in MB of the buffer a recycled view keeps after serving a region request
+  nbThreadsTileLoaderPerLevel_, ///< Number of threads loading tiles running at a time per level, 0 for no limit
+  nbThreadsCopyPerLevel_,   ///< Number of threads copying tiles to the views running at a time per level, 0 for no limit
   viewAvailablePerLevel_,   ///< Number of views available to be used at the same time
   radii_;                   ///< Radii used to build the view
 
   bool
-      ordered_; ///< Define if the views are returned in the same order they have been requested
+      ordered_, ///< Define if the views are returned in the same order they have been requested
+      progressive_, ///< Define if a preview built from a cached coarser level is sent before each requested view
+      numaAware_; ///< Define if the caches, views and threads are placed according to the NUMA topology
 
   FillingType fillingType_; ///< Filling Type Used
 
   std::shared_ptr<AbstractBorderCreator<ViewType>> borderCreator_; ///< BorderCreator to fill the view's ghost region
 
-  std::shared_ptr<AbstractTileLoader<ViewType>> const
+  std::shared_ptr<AbstractTileLoader<ViewType>>
       tileLoader_; ///< TileLoader used by the FastLoaderGraph to load file's tile
 
   TraversalType traversalType_; ///< Traversal type used when all views are requested
 
   std::shared_ptr<AbstractTraversal> traversal_; ///< Traversal instance used when all views are requested
 
+  BufferAllocationType bufferAllocationType_; ///< Allocation of the views and tiles buffers
+
+  CacheAdmissionType cacheAdmissionType_; ///< Admission of the missed tiles in the TileLoader cache
+
+  size_t requestWindow_ = 0; ///< Number of view requests admitted in the graph at a time, 0 for no limit
+
+  bool coalesceRequests_ = false; ///< Serve the duplicate requests of a view in flight with the same view
+
+  std::chrono::milliseconds viewPoolIdleTimeout_{1000}; ///< Time after which an unused view past the views available is freed
+
+  bool autoTuneLoaderThreads_ = false; ///< Tune the number of tile loader threads loading at a time at runtime
+  size_t
+      autoTuneMinThreads_ = 1, ///< Minimum number of tile loader threads loading at a time when tuned
+      autoTuneMaxThreads_ = 0; ///< Maximum number of tile loader threads loading at a time when tuned, 0 for all
+  std::chrono::milliseconds autoTunePeriod_{100}; ///< Period between two adjustments of the tuned number of threads
+
+  std::shared_ptr<AbstractBufferAllocator>
+      bufferAllocator_; ///< Allocator of the views and tiles buffers, nullptr for the default
+
+  std::filesystem::path diskCacheDirectory_; ///< Directory holding the slab files of the persistent cache tier
+
+  std::filesystem::path warmStartSnapshot_; ///< Cache snapshot preloaded at startup, empty for none
+
   size_t
       nbLevels_, ///< File pyramidal level
   nbDimensions_, ///< Number of dimensions
-  nbThreadsCopyPhysicalCacheView_; ///< Number of threads associated with the copy from the physical cache to view task
+  nbThreadsCopyPhysicalCacheView_, ///< Number of threads associated with the copy from the physical cache to view task
+  batchSize_, ///< Number of views in a batch, only used with BatchedView
+  nbThreadsTileLoaderShared_, ///< Number of threads loading tiles running at a time across the levels, 0 for no limit
+  nbThreadsCopyShared_, ///< Number of threads copying tiles running at a time across the levels, 0 for no limit
+  maxCopiesInTileLoader_; ///< Maximum number of copies run by the tile loader threads at a time, 0 if not used
+
+  std::chrono::milliseconds
+      batchTimeout_; ///< Timeout to send a partially filled batch, only used with BatchedView
 
  public:
   /// @brief Default constructor using a tile loader
@@ -168,22 +230,59 @@ class FastLoaderConfiguration {
 
     nbReleasePyramid_ = std::vector<size_t>(tileLoader->nbPyramidLevels(), 1);
     cacheCapacityMB_ = std::vector<size_t>(tileLoader->nbPyramidLevels(), 10);
+    compressedCacheCapacityMB_ = std::vector<size_t>(tileLoader->nbPyramidLevels(), 0);
+    diskCacheCapacityMB_ = std::vector<size_t>(tileLoader->nbPyramidLevels(), 0);
+    pinnedCapacityMB_ = std::vector<size_t>(tileLoader->nbPyramidLevels(), 0);
+    viewPoolCapacityMB_ = std::vector<size_t>(tileLoader->nbPyramidLevels(), 0);
+    regionBufferCapacityMB_ = std::vector<size_t>(tileLoader->nbPyramidLevels(), 64);
+    nbThreadsTileLoaderPerLevel_ = std::vector<size_t>(tileLoader->nbPyramidLevels(), 0);
+    nbThreadsCopyPerLevel_ = std::vector<size_t>(tileLoader->nbPyramidLevels(), 0);
     viewAvailablePerLevel_ = std::vector<size_t>(tileLoader->nbPyramidLevels(), 1);
     fillingType_ = FillingType::DEFAULT;
     borderCreator_ =
         std::make_shared<internal::ConstantBorderCreator<ViewType>>(typename ViewType::data_t());
     traversalType_ = TraversalType::NAIVE;
     traversal_ = std::make_shared<internal::NaiveTraversal>();
+    bufferAllocationType_ = BufferAllocationType::DEFAULT;
+    bufferAllocator_ = nullptr;
+    cacheAdmissionType_ = CacheAdmissionType::ALWAYS;
     ordered_ = false;
+    progressive_ = false;
+    numaAware_ = false;
     nbLevels_ = tileLoader->nbPyramidLevels();
     radii_ = std::vector<size_t>(nbDimensions_);
     nbThreadsCopyPhysicalCacheView_ = 2;
+    nbThreadsTileLoaderShared_ = 0;
+    nbThreadsCopyShared_ = 0;
+    maxCopiesInTileLoader_ = 0;
+    batchSize_ = 1;
+    batchTimeout_ = std::chrono::milliseconds::zero();
   }
 
   /// @brief TileLoader's cache capacity in MB accessor
   /// @return TileLoader's cache capacity in MB
   [[nodiscard]] std::vector<size_t> const &cacheCapacityMB() const { return cacheCapacityMB_; }
 
+  /// @brief TileLoader's compressed cache tier capacity in MB accessor
+  /// @return TileLoader's compressed cache tier capacity in MB, 0 if not used
+  [[nodiscard]] std::vector<size_t> const &compressedCacheCapacityMB() const { return compressedCacheCapacityMB_; }
+
+  /// @brief TileLoader's persistent cache tier capacity in MB accessor
+  /// @return TileLoader's persistent cache tier capacity in MB, 0 if not used
+  [[nodiscard]] std::vector<size_t> const &diskCacheCapacityMB() const { return diskCacheCapacityMB_; }
+
+  /// @brief TileLoader's cache pinned budget in MB accessor
+  /// @return TileLoader's cache capacity in MB that can be pinned, 0 if pinning is disabled
+  [[nodiscard]] std::vector<size_t> const &pinnedCapacityMB() const { return pinnedCapacityMB_; }
+
+  /// @brief View pool capacity in MB accessor
+  /// @return Capacity in MB the view pool can grow to, 0 for a static pool
+  [[nodiscard]] std::vector<size_t> const &viewPoolCapacityMB() const { return viewPoolCapacityMB_; }
+
+  /// @brief Region buffer capacity in MB accessor
+  /// @return Capacity in MB of the buffer a recycled view keeps after serving a region request
+  [[nodiscard]] std::vector<size_t> const &regionBufferCapacityMB() const { return regionBufferCapacityMB_; }
+
   /// @brief Accessor to number of threads associated to the task that copy a physical tile to the view
   /// @return Number of threads associated to the task that copy a physical tile to the view
   [[nodiscard]] size_t nbThreadsCopyPhysicalCacheView() const { return nbThreadsCopyPhysicalCacheView_; }
@@ -203,6 +302,18 @@ class FastLoaderConfiguration {
   /// @param ordered True if the views are ordered in the same way they are requested, else False
   void ordered(bool ordered) { ordered_ = ordered; }
 
+  /// @brief Set if a preview is sent before each requested view, the preview is upsampled from the first coarser level
+  /// having all the needed tiles in cache, and flagged as such (AbstractView::isPreview). The preview is skipped if no
+  /// coarser level is available, and is not part of the ordering. Not available for TileAliasView and BatchedView.
+  /// @param progressive True to send a preview before each requested view, else False
+  void progressive(bool progressive) { progressive_ = progressive; }
+
+  /// @brief Set the NUMA awareness: the tile caches are partitioned and homed per NUMA node, the tile loader and copy
+  /// threads are pinned round-robin on the nodes, and the views are homed on the node of the thread building the graph.
+  /// No-op on a single node system.
+  /// @param numaAware True to place the caches, views and threads according to the NUMA topology, else False
+  void numaAware(bool numaAware) { numaAware_ = numaAware; }
+
   /// @brief Define the number of times a view should return into the graph before being discarded and be available to a
   /// new request
   /// @param releaseCountPerLevel Number of time a view should return into the graph before being discarded and be
@@ -233,6 +344,50 @@ class FastLoaderConfiguration {
     viewAvailablePerLevel_ = nbViewAvailablePerLevel;
   }
 
+  /// @brief Add pyramid levels synthesized from the level below by downsampling by 2, on top of the file levels
+  /// @details The tiles of the virtual levels are built through the caches of the levels below, and cached as any
+  /// other tile. The options per level of the last file level are used for the virtual levels, this method should be
+  /// called before setting options per level.
+  /// @param nbVirtualLevels Number of virtual levels to add
+  /// @param downsamplingType Downsampling used to synthesize the virtual levels [default MEAN]
+  /// @param downsampledDimensions Dimensions to downsample, all dimensions if empty [default empty]
+  /// @throw std::runtime_error If the virtual levels have already been set or if the dimensions are not valid
+  void virtualLevels(size_t nbVirtualLevels, DownsamplingType downsamplingType = DownsamplingType::MEAN,
+                     std::vector<bool> downsampledDimensions = {}) {
+    if (std::dynamic_pointer_cast<internal::VirtualLevelTileLoader<ViewType>>(tileLoader_)) {
+      throw std::runtime_error("The virtual levels can only be set once.");
+    }
+    if (downsampledDimensions.empty()) { downsampledDimensions = std::vector<bool>(nbDimensions_, true); }
+    if (downsampledDimensions.size() != nbDimensions_) {
+      throw std::runtime_error("The dimensions to downsample are not of the right dimension.");
+    }
+    if (nbVirtualLevels == 0) { return; }
+    tileLoader_ = std::make_shared<internal::VirtualLevelTileLoader<ViewType>>(
+        tileLoader_, nbVirtualLevels, downsamplingType, downsampledDimensions);
+    nbLevels_ += nbVirtualLevels;
+    nbReleasePyramid_.resize(nbLevels_, nbReleasePyramid_.back());
+    cacheCapacityMB_.resize(nbLevels_, cacheCapacityMB_.back());
+    compressedCacheCapacityMB_.resize(nbLevels_, compressedCacheCapacityMB_.back());
+    diskCacheCapacityMB_.resize(nbLevels_, 0);
+    pinnedCapacityMB_.resize(nbLevels_, pinnedCapacityMB_.back());
+    viewPoolCapacityMB_.resize(nbLevels_, viewPoolCapacityMB_.back());
+    regionBufferCapacityMB_.resize(nbLevels_, regionBufferCapacityMB_.back());
+    nbThreadsTileLoaderPerLevel_.resize(nbLevels_, nbThreadsTileLoaderPerLevel_.back());
+    nbThreadsCopyPerLevel_.resize(nbLevels_, nbThreadsCopyPerLevel_.back());
+    viewAvailablePerLevel_.resize(nbLevels_, viewAvailablePerLevel_.back());
+  }
+
+  /// @brief Define the batches of BatchedView, the number of views available per level should be at least the batch
+  /// size
+  /// @param batchSize Number of views in a batch
+  /// @param timeout Time after which a partially filled batch is sent, tested when a view is requested or finished, 0
+  /// to only send partially filled batches at the end of the stream [default 0]
+  void batch(size_t batchSize, std::chrono::milliseconds timeout = std::chrono::milliseconds::zero()) {
+    if (batchSize == 0) { throw std::runtime_error("The batch size should not be equal to zero."); }
+    batchSize_ = batchSize;
+    batchTimeout_ = timeout;
+  }
+
   /// @brief Define the TileLoader Cache capacity
   /// @param cacheCapacityMBPerLevel TileLoader cache capacity in MB per level to set
   void cacheCapacityMB(std::vector<size_t> const &cacheCapacityMBPerLevel) {
@@ -247,6 +402,102 @@ class FastLoaderConfiguration {
     cacheCapacityMB_ = cacheCapacityMBPerLevel;
   }
 
+  /// @brief Define the capacity of the compressed cache tier. The tiles evicted from the TileLoader cache are compressed
+  /// with a fast lossless codec (byte shuffle + LZ) and looked for before loading a tile from the file.
+  /// @param compressedCacheCapacityMBPerLevel Compressed cache tier capacity in MB per level, 0 to disable the tier
+  void compressedCacheCapacityMB(std::vector<size_t> const &compressedCacheCapacityMBPerLevel) {
+    if (compressedCacheCapacityMBPerLevel.size() != nbLevels_) {
+      throw std::runtime_error("The compressed cache capacity per level is not set for every level.");
+    }
+    compressedCacheCapacityMB_ = compressedCacheCapacityMBPerLevel;
+  }
+
+  /// @brief Define the pinned budget of the TileLoader cache. The tiles pinned with FastLoaderGraph::pinTiles are never
+  /// evicted, so hot tiles (overviews, tiles shared by many clients) survive scans running on the same graph. The budget
+  /// is bounded by the cache capacity, minus one tile per NUMA partition so unpinned requests can still progress.
+  /// @param pinnedCapacityMBPerLevel Cache capacity in MB that can be pinned per level, 0 to disable pinning
+  void pinnedCapacityMB(std::vector<size_t> const &pinnedCapacityMBPerLevel) {
+    if (pinnedCapacityMBPerLevel.size() != nbLevels_) {
+      throw std::runtime_error("The pinned capacity per level is not set for every level.");
+    }
+    pinnedCapacityMB_ = pinnedCapacityMBPerLevel;
+  }
+
+  /// @brief Define the admission of the missed tiles in the TileLoader cache. With CacheAdmissionType::TINY_LFU, the
+  /// access frequencies of the tiles are estimated, and a missed tile accessed less often than the tile it evicts is
+  /// inserted as the least recently used tile, so a batch traversal does not flush the tiles used interactively. The
+  /// views requested with the no cache hint (FastLoaderGraph::requestView / requestAllViews) are never admitted.
+  /// @param cacheAdmissionType Admission of the missed tiles [default CacheAdmissionType::ALWAYS]
+  void cacheAdmission(CacheAdmissionType cacheAdmissionType) { cacheAdmissionType_ = cacheAdmissionType; }
+
+  /// @brief Define the number of view requests admitted in the graph at a time. The other requests wait in a priority
+  /// queue, so a request with a higher priority (FastLoaderGraph::requestView) overtakes the waiting ones instead of
+  /// waiting for all the requests made before it. A request leaves the graph when its view is sent. A small window
+  /// reduces the latency of the prioritized requests, a large window keeps the graph busy. The requests of
+  /// FastLoaderGraph::requestAllViews are created as they are admitted, bounding the memory used by large traversals.
+  /// @param nbRequests Number of view requests admitted in the graph at a time, 0 for no limit and no priority
+  void requestWindow(size_t nbRequests) { requestWindow_ = nbRequests; }
+
+  /// @brief Define if the duplicate requests of a view in flight (same central tile and level, e.g. from several viewer
+  /// sessions) are served by the same view instead of a view per request. The view is loaded once, then sent once per
+  /// request, and should be returned to the memory manager once per request. The view is shared, so it should not be
+  /// modified. Not used if the ordering is requested, nor for the region and preview requests and the BatchedView.
+  /// @param coalesceRequests True to coalesce the duplicate requests [default false]
+  void coalesceRequests(bool coalesceRequests) { coalesceRequests_ = coalesceRequests; }
+
+  /// @brief Define the elastic view pools. The pool of a level starts with the number of views available
+  /// (viewAvailable), and when a view is requested while the pool is empty and the tile loaders are idle (the views are
+  /// held downstream), a new view is allocated instead of starving the pipeline, up to the capacity. The views allocated
+  /// past the number of views available are freed once unused for the idle timeout. Not used for the TileAliasView and
+  /// BatchedView whose buffers are held by the cache or the batches. See FastLoaderGraph::viewPoolStatistics.
+  /// @param viewPoolCapacityMBPerLevel Capacity in MB the view pool can grow to per level, 0 for a static pool
+  /// @param idleTimeout Time after which an unused view past the views available is freed [default 1s]
+  void elasticViewPool(std::vector<size_t> const &viewPoolCapacityMBPerLevel,
+                       std::chrono::milliseconds idleTimeout = std::chrono::milliseconds(1000)) {
+    if (viewPoolCapacityMBPerLevel.size() != nbLevels_) {
+      throw std::runtime_error("The view pool capacity per level is not set for every level.");
+    }
+    viewPoolCapacityMB_ = viewPoolCapacityMBPerLevel;
+    viewPoolIdleTimeout_ = idleTimeout;
+  }
+
+  /// @brief Define the capacity of the buffer a recycled view keeps after serving a region request. The buffer of a view
+  /// grows to the size of the regions requested, and is kept to serve the next regions without allocating, up to the
+  /// capacity: a larger buffer is freed when the view is recycled and the buffer goes back to the view size. Not used
+  /// for the TileAliasView and BatchedView, that can not be requested as a region.
+  /// @param regionBufferCapacityMBPerLevel Capacity in MB of the buffer kept per level, 0 to always go back to the view
+  /// size [default 64 for every level]
+  void regionBufferCapacityMB(std::vector<size_t> const &regionBufferCapacityMBPerLevel) {
+    if (regionBufferCapacityMBPerLevel.size() != nbLevels_) {
+      throw std::runtime_error("The region buffer capacity per level is not set for every level.");
+    }
+    regionBufferCapacityMB_ = regionBufferCapacityMBPerLevel;
+  }
+
+  /// @brief Define a cache snapshot, saved by a previous run with FastLoaderGraph::saveCacheSnapshot, to preload in the
+  /// background when the graph is created. The tiles are loaded by a dedicated thread with a copy of the tile loader
+  /// (copyTileLoader needs to be implemented), while no live request is being loaded, and only fill the free cache
+  /// slots. A missing snapshot file is ignored.
+  /// @param snapshot Cache snapshot file path
+  void warmStart(std::filesystem::path const &snapshot) { warmStartSnapshot_ = snapshot; }
+
+  /// @brief Define the persistent cache tier. The tiles loaded from the file are written to memory-mapped slab files,
+  /// one per level, named after the file identity (path, size and modification date), and are read back instead of
+  /// being loaded again, in this run or in the next ones. The least recently used tiles are replaced once a slab file is
+  /// full. The virtual levels are not persisted. Only available on Linux.
+  /// @param directory Directory holding the slab files, should be on a fast local drive
+  /// @param diskCacheCapacityMBPerLevel Persistent cache tier capacity in MB per level, 0 to disable the tier
+  void diskCache(std::filesystem::path const &directory, std::vector<size_t> const &diskCacheCapacityMBPerLevel) {
+    if (!std::filesystem::is_directory(directory)) {
+      throw std::runtime_error("The disk cache directory " + directory.string() + " does not exist.");
+    }
+    if (diskCacheCapacityMBPerLevel.size() != nbLevels_) {
+      throw std::runtime_error("The disk cache capacity per level is not set for every level.");
+    }
+    diskCacheDirectory_ = directory;
+    diskCacheCapacityMB_ = diskCacheCapacityMBPerLevel;
+  }
+
   /// @brief Set the chosen Traversal amongst the ones available
   /// @param traversalType Traversal to set
   void traversalType(TraversalType traversalType) {
@@ -304,6 +555,38 @@ class FastLoaderConfiguration {
     borderCreator_ = borderCreator;
   }
 
+  /// @brief Define the allocation of the views and tiles buffers, except for the custom one
+  /// @details The view buffers and the tile buffers, handed to the tile loader as TileBuffer, come from the allocator.
+  /// @param bufferAllocationType Type of buffer allocation
+  /// @throw std::runtime_error If the custom allocation is requested
+  void bufferAllocation(BufferAllocationType bufferAllocationType) {
+    switch (bufferAllocationType) {
+      case BufferAllocationType::DEFAULT: bufferAllocator_ = nullptr;
+        break;
+      case BufferAllocationType::ALIGNED: bufferAllocator_ = std::make_shared<internal::AlignedBufferAllocator>();
+        break;
+      case BufferAllocationType::HUGE_PAGE:
+        bufferAllocator_ = std::make_shared<internal::HugePageBufferAllocator>(false);
+        break;
+      case BufferAllocationType::EXPLICIT_HUGE_PAGE:
+        bufferAllocator_ = std::make_shared<internal::HugePageBufferAllocator>(true);
+        break;
+      case BufferAllocationType::CUSTOM:
+        throw std::runtime_error("This buffer allocation need a custom implementation of AbstractBufferAllocator, "
+                                 "please call bufferAllocatorCustom(std::shared_ptr<AbstractBufferAllocator>).");
+    }
+    bufferAllocationType_ = bufferAllocationType;
+  }
+
+  /// @brief Define a custom allocator for the views and tiles buffers
+  /// @param bufferAllocator Custom buffer allocator to use
+  /// @throw std::runtime_error If the buffer allocator is nullptr
+  void bufferAllocatorCustom(std::shared_ptr<AbstractBufferAllocator> bufferAllocator) {
+    if (!bufferAllocator) { throw std::runtime_error("The custom buffer allocator should not be nullptr."); }
+    bufferAllocationType_ = BufferAllocationType::CUSTOM;
+    bufferAllocator_ = std::move(bufferAllocator);
+  }
+
   /// @brief Define the number of threads attached to the task doing the copy from the physical cache to the view
   /// @param nbThreadsCopyPhysicalCacheView
   void nbThreadsCopyPhysicalCacheView(size_t nbThreadsCopyPhysicalCacheView) {
@@ -313,6 +596,62 @@ class FastLoaderConfiguration {
     }
     nbThreadsCopyPhysicalCacheView_ = nbThreadsCopyPhysicalCacheView;
   }
+
+  /// @brief Define the number of threads loading tiles and copying them to the views running at a time per level. Every
+  /// level has the threads of the tile loader and of the copy task, the threads past the limit of their level wait, e.g.
+  /// to keep the coarse levels of a deep pyramid from oversubscribing the cores used by the level 0. A thread only counts
+  /// while loading a tile missed in the cache or copying a tile it holds, the cache hits and the threads waiting for a
+  /// tile in use are never limited.
+  /// @param nbThreadsTileLoaderPerLevel Number of threads loading tiles running at a time per level, 0 for no limit
+  /// @param nbThreadsCopyPerLevel Number of threads copying tiles running at a time per level, 0 for no limit
+  /// @throw std::runtime_error If the number of threads is not set for every level
+  void levelThreads(std::vector<size_t> const &nbThreadsTileLoaderPerLevel,
+                    std::vector<size_t> const &nbThreadsCopyPerLevel) {
+    if (nbThreadsTileLoaderPerLevel.size() != nbLevels_ || nbThreadsCopyPerLevel.size() != nbLevels_) {
+      throw std::runtime_error("The number of threads per level is not set for every level.");
+    }
+    nbThreadsTileLoaderPerLevel_ = nbThreadsTileLoaderPerLevel;
+    nbThreadsCopyPerLevel_ = nbThreadsCopyPerLevel;
+  }
+
+  /// @brief Define the number of threads loading tiles and copying them to the views running at a time across all the
+  /// levels, the levels share this pool of running threads while keeping their own queues. Can be combined with
+  /// levelThreads.
+  /// @param nbThreadsTileLoader Number of threads loading tiles running at a time across the levels, 0 for no limit
+  /// @param nbThreadsCopy Number of threads copying tiles running at a time across the levels, 0 for no limit
+  void sharedLevelThreads(size_t nbThreadsTileLoader, size_t nbThreadsCopy) {
+    nbThreadsTileLoaderShared_ = nbThreadsTileLoader;
+    nbThreadsCopyShared_ = nbThreadsCopy;
+  }
+
+  /// @brief Define if the tile loader threads copy the tiles from the physical cache to the views.
+  /// Each tile loader thread loads the tile if it is missed in the cache, then copies it to the view itself. The copies
+  /// running at a time across the levels are capped by maxConcurrentCopies, a tile loader thread waiting for a copy
+  /// slot once its tile is loaded, and no slot is held while loading from the file. The copy task only forwards the
+  /// views on a single thread, so nbThreadsCopyPhysicalCacheView is not used. The threads running the loads and the
+  /// copies are the tile loader threads, so the tile loader needs more threads than maxConcurrentCopies for loads to
+  /// go on while copies run, and its number of threads is still to be tuned for the storage. Not available for
+  /// TileAliasView, where the tiles are not copied.
+  /// @param maxConcurrentCopies Maximum number of copies running at a time across the levels, 0 to copy in the copy
+  /// task
+  void copyInTileLoader(size_t maxConcurrentCopies) { maxCopiesInTileLoader_ = maxConcurrentCopies; }
+
+  /// @brief Define if the number of tile loader threads loading at a time is tuned at runtime, instead of tuning the
+  /// number of threads of the tile loader for each storage (NVMe, network file system, page cache...). The throughput
+  /// and the latency of the loads are measured for each period, and the number of threads loading is moved up or down
+  /// within the bounds, keeping a change only if it improves the throughput. The other threads are parked. See
+  /// FastLoaderGraph::loaderTuningStatistics.
+  /// @param minThreads Minimum number of threads loading at a time [default 1]
+  /// @param maxThreads Maximum number of threads loading at a time, 0 for all the tile loader threads of all the levels
+  /// [default 0]
+  /// @param period Period between two adjustments [default 100ms]
+  void autoTuneLoaderThreads(size_t minThreads = 1, size_t maxThreads = 0,
+                             std::chrono::milliseconds period = std::chrono::milliseconds(100)) {
+    autoTuneLoaderThreads_ = true;
+    autoTuneMinThreads_ = minThreads;
+    autoTuneMaxThreads_ = maxThreads;
+    autoTunePeriod_ = period;
+  }
 };
 
 } // fl
@@ -20,7 +20,13 @@
 #define FAST_LOADER_FAST_LOADER_GRAPH_H
 
 #include <hedgehog/hedgehog.h>
+#include <list>
 #include "../data/index_request.h"
+#include "../data/region_request.h"
+#include "../data/preview_request.h"
+#include "../data/view_batch.h"
+#include "../data/view_pool_statistics.h"
+#include "../data/loader_tuning_statistics.h"
 #include "fast_loader_configuration.h"
 #include "../view/unified_view.h"
 #include "../../core/task/view_counter.h"
@@ -29,6 +35,11 @@
 #include "../../core/fast_loader_memory_manager.h"
 #include "../../core/fast_loader_execution_pipeline.h"
 #include "../../core/task/copy_physical_to_view.h"
+#include "../../core/task/alias_physical_to_view.h"
+#include "../../core/task/view_batcher.h"
+#include "../../core/task/preview_builder.h"
+#include "../../core/buffer_allocator/numa_buffer_allocator.h"
+#include "../../core/cache_warmer.h"
 
 
 /// @brief FastLoader namespace
@@ -100,6 +111,30 @@ class FastLoaderGraph : public hh::Graph<1, IndexRequest, ViewType> {
       tileDimensionPerLevel_{}, ///< Tile dimensions acquired by the TL
       viewDimensionPerLevel_{}; ///< View dimensions computed
 
+  std::shared_ptr<internal::NumaTopology>
+      numaTopology_{}; ///< NUMA topology used to place the caches, views and threads, nullptr if not NUMA aware
+
+  std::unique_ptr<internal::CacheWarmer<typename ViewType::data_t>>
+      cacheWarmer_{}; ///< Background preloading of a cache snapshot, nullptr if not used
+
+  std::shared_ptr<internal::RequestScheduler>
+      requestScheduler_{}; ///< Scheduler admitting the requests by priority, nullptr if not used
+
+  std::shared_ptr<internal::ViewPoolPolicy>
+      viewPoolPolicy_{}; ///< Sizing and counters of the view pools, shared by the memory managers
+
+  std::unique_ptr<internal::ViewPoolTrimmer>
+      viewPoolTrimmer_{}; ///< Periodic trimming of the elastic view pools, nullptr if no pool is elastic
+
+  std::shared_ptr<AbstractTileLoader<ViewType>>
+      pinTileLoader_{}; ///< Tile loader copy loading the pinned tiles, created on the first pin
+  std::mutex pinMutex_{}; ///< Mutex serializing the pinTiles calls
+
+  std::list<std::weak_ptr<RequestHandle>>
+      requestHandles_{}; ///< Handles of the pending requests, to cancel them by region
+  size_t requestHandlesPurgeSize_ = 1024; ///< Number of registered handles triggering a purge of the expired ones
+  std::mutex requestHandlesMutex_{}; ///< Mutex protecting the registered handles
+
  public:
   /// @brief Main FastLoaderGraph constructor
   /// @param configuration FastLoaderGraph configuration. Need to be moved, and can not be modified after being set.
@@ -127,6 +162,7 @@ class FastLoaderGraph : public hh::Graph<1, IndexRequest, ViewType> {
     tileLoader_ = configuration_->tileLoader_;
     nbDimensions_ = tileLoader_->nbDims();
     nbPyramidLevels_ = tileLoader_->nbPyramidLevels();
+    setupNuma();
 
     fullDimensionPerLevel_->reserve(nbPyramidLevels_);
     tileDimensionPerLevel_->reserve(nbPyramidLevels_);
@@ -168,20 +204,36 @@ class FastLoaderGraph : public hh::Graph<1, IndexRequest, ViewType> {
                   (double) 1,
                   (double) (configuration_->cacheCapacityMB().at(level)) / sizeTileMB
               ),
-              tileDimensionPerLevel_->at(level)
+              tileDimensionPerLevel_->at(level),
+              configuration_->bufferAllocator_,
+              numaTopology_,
+              compressedCache(level),
+              diskCache(level, tileDimensionPerLevel_->at(level)),
+              (size_t) ((double) (configuration_->pinnedCapacityMB().at(level)) / sizeTileMB),
+              configuration_->cacheAdmissionType_
           ));
 
     }
     tileLoader_->allCaches_ = tileLoaderAllCaches;
+    tileLoader_->threadLimiter_ = createLevelThreadLimiter(
+        configuration_->nbThreadsTileLoaderPerLevel_, configuration_->nbThreadsTileLoaderShared_);
+    auto copyThreadLimiter = createLevelThreadLimiter(
+        configuration_->nbThreadsCopyPerLevel_, configuration_->nbThreadsCopyShared_);
+    tileLoader_->copyLimiter_ = createTileLoaderCopyLimiter();
+    if (tileLoader_->copyLimiter_) { tileLoader_->copyThreadLimiter_ = copyThreadLimiter; }
+    tileLoader_->autoTuner_ = createLoaderAutoTuner();
 
     // Create the tasks
-    auto viewCounter
-        = std::make_shared<internal::ViewCounter<ViewType>>(configuration_->borderCreator_, configuration_->ordered_);
+    createRequestScheduler();
+    auto viewCounter = std::make_shared<internal::ViewCounter<ViewType>>(
+        configuration_->borderCreator_, configuration_->ordered_, requestScheduler_,
+        configuration_->coalesceRequests_ && !std::is_base_of_v<BatchedView<typename ViewType::data_t>, ViewType>);
     // Internal graph
     levelGraph_ =
         std::make_shared<hh::Graph<1, IndexRequest, internal::TileRequest<ViewType>>>("Fast Loader Level");
 
-    auto cpyPhysicalToView = std::make_shared<internal::CopyPhysicalToView<ViewType>>(this->configuration_->nbThreadsCopyPhysicalCacheView());
+    // Allocator handing out the batch slots, only used with BatchedView
+    std::shared_ptr<internal::BatchAllocator<typename ViewType::data_t>> batchAllocator = nullptr;
 
     // Task & memory manager
     if constexpr (std::is_base_of<DefaultView<typename ViewType::data_t>, ViewType>::value) {
@@ -192,12 +244,97 @@ class FastLoaderGraph : public hh::Graph<1, IndexRequest, ViewType> {
           configuration_->ordered_, configuration_->fillingType_, viewCounter,
           fullDimensionPerLevel_, tileDimensionPerLevel_, configuration_->radii_, tileLoader_->dimNames()
       );
-      auto mm = std::make_shared<internal::FastLoaderMemoryManager<ViewDataType>>(
-          this->configuration_->viewAvailablePerLevel_, sizeMemoryManagerPerLevel, configuration_->nbReleasePyramid_);
+      auto mm = createMemoryManager<ViewDataType>(sizeMemoryManagerPerLevel);
+      viewWaiter->connectMemoryManager(mm);
+      auto cpyPhysicalToView =
+          std::make_shared<internal::CopyPhysicalToView<ViewType>>(
+              nbThreadsCopy(), numaTopology_, copyThreadLimiter);
+      levelGraph_->inputs(viewWaiter);
+      if (configuration_->progressive_) {
+        auto previewBuilder = std::make_shared<internal::PreviewBuilder<ViewType, ViewDataType>>(
+            tileLoaderAllCaches, fullDimensionPerLevel_, tileDimensionPerLevel_);
+        levelGraph_->edges(viewWaiter, previewBuilder);
+        levelGraph_->edges(previewBuilder, viewLoader);
+        levelGraph_->outputs(previewBuilder);
+      } else {
+        levelGraph_->edges(viewWaiter, viewLoader);
+      }
+      levelGraph_->edges(viewLoader, tileLoader_);
+      levelGraph_->edges(tileLoader_, cpyPhysicalToView);
+      levelGraph_->outputs(cpyPhysicalToView);
+    } else if constexpr (std::is_base_of<TileAliasView<typename ViewType::data_t>, ViewType>::value) {
+      using ViewDataType = internal::TileAliasViewData<typename ViewType::data_t>;
+      if (configuration_->progressive_) {
+        throw std::runtime_error("The progressive mode is not available for TileAliasView.");
+      }
+      if (tileLoader_->copyLimiter_) {
+        throw std::runtime_error(
+            "The copy in the tile loader is not available for TileAliasView, the tiles are not copied.");
+      }
+      if (std::any_of(configuration_->radii_.cbegin(), configuration_->radii_.cend(),
+                      [](auto const &radius) { return radius != 0; })) {
+        throw std::runtime_error("A TileAliasView can only be used with a radius of 0 for all dimensions.");
+      }
+      for (size_t level = 0; level < nbPyramidLevels_; ++level) {
+        if (configuration_->viewAvailablePerLevel_.at(level) > tileLoaderAllCaches->at(level)->nbTilesCache()) {
+          std::ostringstream oss;
+          oss << "The number of TileAliasView available for the level " << level << " ("
+              << configuration_->viewAvailablePerLevel_.at(level)
+              << ") can not exceed the number of tiles in cache ("
+              << tileLoaderAllCaches->at(level)->nbTilesCache() << ").";
+          throw std::runtime_error(oss.str());
+        }
+      }
+      auto viewLoader =
+          std::make_shared<internal::ViewLoader<ViewType, ViewDataType>>(configuration_->borderCreator_);
+      auto viewWaiter = std::make_shared<internal::ViewWaiter<ViewType, ViewDataType>>(
+          configuration_->ordered_, configuration_->fillingType_, viewCounter,
+          fullDimensionPerLevel_, tileDimensionPerLevel_, configuration_->radii_, tileLoader_->dimNames()
+      );
+      auto mm = createMemoryManager<ViewDataType>(sizeMemoryManagerPerLevel, false);
       viewWaiter->connectMemoryManager(mm);
+      auto aliasPhysicalToView = std::make_shared<internal::AliasPhysicalToView<ViewType>>(
+          configuration_->borderCreator_);
       levelGraph_->inputs(viewWaiter);
       levelGraph_->edges(viewWaiter, viewLoader);
       levelGraph_->edges(viewLoader, tileLoader_);
+      levelGraph_->edges(tileLoader_, aliasPhysicalToView);
+      levelGraph_->outputs(aliasPhysicalToView);
+    }
+    else if constexpr (std::is_base_of<BatchedView<typename ViewType::data_t>, ViewType>::value) {
+      using ViewDataType = internal::BatchedViewData<typename ViewType::data_t>;
+      if (configuration_->progressive_) {
+        throw std::runtime_error("The progressive mode is not available for BatchedView.");
+      }
+      for (size_t level = 0; level < nbPyramidLevels_; ++level) {
+        if (configuration_->viewAvailablePerLevel_.at(level) < configuration_->batchSize_) {
+          std::ostringstream oss;
+          oss << "The number of BatchedView available for the level " << level << " ("
+              << configuration_->viewAvailablePerLevel_.at(level)
+              << ") should be at least the batch size (" << configuration_->batchSize_ << ").";
+          throw std::runtime_error(oss.str());
+        }
+      }
+      batchAllocator = std::make_shared<internal::BatchAllocator<typename ViewType::data_t>>(
+          configuration_->batchSize_, configuration_->batchTimeout_, sizeMemoryManagerPerLevel,
+          configuration_->bufferAllocator_);
+      auto viewLoader =
+          std::make_shared<internal::ViewLoader<ViewType, ViewDataType>>(configuration_->borderCreator_);
+      auto viewWaiter = std::make_shared<internal::ViewWaiter<ViewType, ViewDataType>>(
+          configuration_->ordered_, configuration_->fillingType_, viewCounter,
+          fullDimensionPerLevel_, tileDimensionPerLevel_, configuration_->radii_, tileLoader_->dimNames(),
+          batchAllocator
+      );
+      auto mm = createMemoryManager<ViewDataType>(sizeMemoryManagerPerLevel, false);
+      viewWaiter->connectMemoryManager(mm);
+      auto cpyPhysicalToView =
+          std::make_shared<internal::CopyPhysicalToView<ViewType>>(
+              nbThreadsCopy(), numaTopology_, copyThreadLimiter);
+      levelGraph_->inputs(viewWaiter);
+      levelGraph_->edges(viewWaiter, viewLoader);
+      levelGraph_->edges(viewLoader, tileLoader_);
+      levelGraph_->edges(tileLoader_, cpyPhysicalToView);
+      levelGraph_->outputs(cpyPhysicalToView);
     }
 #ifdef HH_USE_CUDA
     else if constexpr (std::is_base_of<UnifiedView<typename ViewType::data_t>, ViewType>::value) {
@@ -207,19 +344,29 @@ class FastLoaderGraph : public hh::Graph<1, IndexRequest, ViewType> {
       auto viewWaiter = std::make_shared<internal::ViewWaiter<ViewType, ViewDataType>>(
           configuration_->ordered_, configuration_->fillingType_, viewCounter,
           fullDimensionPerLevel_, tileDimensionPerLevel_, configuration_->radii_, tileLoader_->dimNames());
-      auto mm = std::make_shared<internal::FastLoaderMemoryManager<ViewDataType>>(
-          this->configuration_->viewAvailablePerLevel_, sizeMemoryManagerPerLevel, configuration_->nbReleasePyramid_);
+      auto mm = createMemoryManager<ViewDataType>(sizeMemoryManagerPerLevel);
       viewWaiter->connectMemoryManager(mm);
+      auto cpyPhysicalToView =
+          std::make_shared<internal::CopyPhysicalToView<ViewType>>(
+              nbThreadsCopy(), numaTopology_, copyThreadLimiter);
       levelGraph_->inputs(viewWaiter);
-      levelGraph_->edges(viewWaiter, viewLoader);
+      if (configuration_->progressive_) {
+        auto previewBuilder = std::make_shared<internal::PreviewBuilder<ViewType, ViewDataType>>(
+            tileLoaderAllCaches, fullDimensionPerLevel_, tileDimensionPerLevel_);
+        levelGraph_->edges(viewWaiter, previewBuilder);
+        levelGraph_->edges(previewBuilder, viewLoader);
+        levelGraph_->outputs(previewBuilder);
+      } else {
+        levelGraph_->edges(viewWaiter, viewLoader);
+      }
       levelGraph_->edges(viewLoader, tileLoader_);
+      levelGraph_->edges(tileLoader_, cpyPhysicalToView);
+      levelGraph_->outputs(cpyPhysicalToView);
     }
 #endif // HH_USE_CUDA
     else {
       throw std::runtime_error("The View Data Type inside of the used View is not known to construct the graph.");
     }
-    levelGraph_->edges(tileLoader_, cpyPhysicalToView);
-    levelGraph_->outputs(cpyPhysicalToView);
 
     // Internal Execution pipeline
     auto levelExecutionPipeline =
@@ -229,13 +376,114 @@ class FastLoaderGraph : public hh::Graph<1, IndexRequest, ViewType> {
     // Fast Loader graph
     this->inputs(levelExecutionPipeline);
     this->edges(levelExecutionPipeline, viewCounter);
-    this->outputs(viewCounter);
+    if (batchAllocator) {
+      auto viewBatcher = std::make_shared<internal::ViewBatcher<ViewType>>(batchAllocator);
+      this->edges(viewCounter, viewBatcher);
+      this->outputs(viewBatcher);
+    } else {
+      this->outputs(viewCounter);
+    }
+    startWarmStart();
+  }
+
+  /// @brief Write the indices of the tiles resident in the caches to a snapshot file, to warm start a next run
+  /// (FastLoaderConfiguration::warmStart)
+  /// @param path Snapshot file path
+  /// @throw std::runtime_error If the file can not be written
+  void saveCacheSnapshot(std::filesystem::path const &path) const {
+    internal::CacheWarmer<typename ViewType::data_t>::save(path, *tileLoader_->allCaches_);
+  }
+
+  /// @brief Number of tiles preloaded from the warm start snapshot accessor
+  /// @return Number of tiles preloaded so far
+  [[nodiscard]] size_t nbWarmStartTiles() const { return cacheWarmer_ ? cacheWarmer_->nbPreloadedTiles() : 0; }
+
+  /// @brief Warm start over flag accessor
+  /// @return True if the warm start is over or not used
+  [[nodiscard]] bool warmStartDone() const { return !cacheWarmer_ || cacheWarmer_->done(); }
+
+  /// @brief Pin the tiles of a level in the index range [begin, end), pinned tiles are never evicted from the cache
+  /// @details The tiles are pinned in the range order until the pinned budget of the level is exhausted
+  /// (FastLoaderConfiguration::pinnedCapacityMB), then loaded eagerly in the calling thread with a copy of the tile
+  /// loader (copyTileLoader needs to be implemented). With the AdaptiveFastLoaderGraph, the indices are the ones of the
+  /// physical tiles.
+  /// @param level Pyramidal level
+  /// @param begin Index of the first tile
+  /// @param end Index past the last tile, for every dimension
+  /// @return Number of tiles pinned, lower than the number of tiles in the range if the pinned budget is exhausted
+  /// @throw std::runtime_error If the level or the range is not valid
+  size_t pinTiles(size_t level, std::vector<size_t> const &begin, std::vector<size_t> const &end) {
+    auto const &cache = pinnedCache(level, begin, end);
+    std::lock_guard<std::mutex> lock(pinMutex_);
+    if (!pinTileLoader_) { pinTileLoader_ = standaloneTileLoader(); }
+    size_t nbPinned = 0;
+    std::vector<size_t> index(begin);
+    do {
+      if (!cache->pin(index)) { break; }
+      ++nbPinned;
+      auto tile = cache->lockedTile(index);
+      tile->lock();
+      if (tile->newTile()) {
+        tile->newTile(false);
+        if (!cache->restoreTile(tile)) {
+          pinTileLoader_->loadTileFromFile(tile->data(), index, level);
+          cache->saveTile(tile);
+        }
+      }
+      tile->unlock();
+      tile->releaseSemaphore();
+    } while (nextTileIndex(index, begin, end));
+    return nbPinned;
   }
 
+  /// @brief Unpin the tiles of a level in the index range [begin, end), they stay in cache and are evicted following
+  /// the LRU order
+  /// @param level Pyramidal level
+  /// @param begin Index of the first tile
+  /// @param end Index past the last tile, for every dimension
+  /// @throw std::runtime_error If the level or the range is not valid
+  void unpinTiles(size_t level, std::vector<size_t> const &begin, std::vector<size_t> const &end) {
+    auto const &cache = pinnedCache(level, begin, end);
+    std::vector<size_t> index(begin);
+    do { cache->unpin(index); } while (nextTileIndex(index, begin, end));
+  }
+
+  /// @brief Number of pinned tiles accessor
+  /// @param level Pyramidal level
+  /// @return Number of tiles pinned in the level
+  [[nodiscard]] size_t nbPinnedTiles(size_t level) const { return tileLoader_->allCaches_->at(level)->nbPinnedTiles(); }
+
   /// @brief Dimensions name accessor
   /// @return Dimensions name
   [[nodiscard]] std::vector<std::string> const &dimNames() const { return tileLoader_->dimNames(); }
 
+  /// @brief Number of pyramidal levels accessor, including the virtual levels
+  /// @return Number of pyramidal levels
+  [[nodiscard]] size_t nbPyramidLevels() const { return nbPyramidLevels_; }
+
+  /// @brief View pool statistics accessor, see FastLoaderConfiguration::elasticViewPool
+  /// @param level Pyramidal level
+  /// @return Statistics of the view pool of the level
+  /// @throw std::runtime_error If the level does not exist
+  [[nodiscard]] ViewPoolStatistics viewPoolStatistics(size_t level = 0) const {
+    if (level >= nbPyramidLevels_) {
+      std::ostringstream oss;
+      oss << "The level " << level << " does not exist.";
+      throw std::runtime_error(oss.str());
+    }
+    return viewPoolPolicy_->countersPerLevel.at(level)->statistics();
+  }
+
+  /// @brief Tile loader threads auto-tuner statistics accessor, see FastLoaderConfiguration::autoTuneLoaderThreads
+  /// @return Statistics of the auto-tuner
+  /// @throw std::runtime_error If the tile loader threads are not auto-tuned
+  [[nodiscard]] LoaderTuningStatistics loaderTuningStatistics() const {
+    if (!tileLoader_->autoTuner_) {
+      throw std::runtime_error("The tile loader threads are not auto-tuned.");
+    }
+    return tileLoader_->autoTuner_->statistics();
+  }
+
   /// @brief File dimensions accessor for a level
   /// @param level Pyramidal Level
   /// @return File dimensions for a level
@@ -324,26 +572,117 @@ class FastLoaderGraph : public hh::Graph<1, IndexRequest, ViewType> {
   /// @brief Request a view
   /// @param indexCentralTile View Index
   /// @param level Pyramidal level
-  void requestView(std::vector<size_t> const &indexCentralTile, size_t level = 0) {
-    if (finishRequestingTiles_) { return; }
+  /// @param noCache Hint to not admit the tiles missed for the view in the cache, for batch traversals [default false]
+  /// @param priority Priority, the views with a higher priority overtake the waiting ones if a request window is set
+  /// (FastLoaderConfiguration::requestWindow) [default 0]
+  /// @return Handle to cancel the request, nullptr if the views are not requested anymore
+  std::shared_ptr<RequestHandle> requestView(std::vector<size_t> const &indexCentralTile, size_t level = 0,
+                                             bool noCache = false, int priority = 0) {
+    if (finishRequestingTiles_) { return nullptr; }
     assert(testIndex(indexCentralTile, level));
-    this->pushData(std::make_shared<IndexRequest>(indexCentralTile, level));
+    auto indexRequest = std::make_shared<IndexRequest>(indexCentralTile, level, noCache, priority);
+    auto handle = registerRequest(indexRequest);
+    submitRequest(indexRequest);
+    return handle;
+  }
+
+  /// @brief Request an arbitrary region, not aligned on tiles, the view's buffer is sized to the region
+  /// @details Elements outside of the file are filled following the configured border creator
+  /// @param origin Global position of the first element of the region
+  /// @param extent Region dimensions
+  /// @param level Pyramidal level
+  /// @param priority Priority, the views with a higher priority overtake the waiting ones if a request window is set
+  /// (FastLoaderConfiguration::requestWindow) [default 0]
+  /// @return Handle to cancel the request, nullptr if the views are not requested anymore
+  /// @throw std::runtime_error If the region is not valid
+  std::shared_ptr<RequestHandle> requestRegion(std::vector<size_t> const &origin, std::vector<size_t> const &extent,
+                                               size_t level = 0, int priority = 0)
+  requires internal::traits::owns_buffer_v<ViewType> {
+    if (finishRequestingTiles_) { return nullptr; }
+    auto regionRequest = std::static_pointer_cast<IndexRequest>(generateRegionRequest(origin, extent, level));
+    regionRequest->priority_ = priority;
+    auto handle = registerRequest(regionRequest);
+    if (requestScheduler_) { requestScheduler_->submit(regionRequest); }
+    else { this->pushData(regionRequest); }
+    return handle;
   }
 
   /// @brief Request all the views for a level following the traversal set in configuration
+  /// @details If a request window is set (FastLoaderConfiguration::requestWindow), the requests are created one at a
+  /// time as views are sent, so the memory used does not depend on the number of views. The pending requests are then
+  /// cancelled with cancelRequests(level), cancelRequests by region only cancels the requests already created. The
+  /// views of the same priority requested meanwhile are interleaved with the stream instead of waiting for its end.
   /// @param level AbstractView's level requested
-  void requestAllViews(size_t level = 0) {
+  /// @param noCache Hint to not admit the tiles missed for the views in the cache, so the traversal does not flush the
+  /// tiles used by the other requests [default false]
+  /// @param priority Priority, the views with a higher priority overtake the waiting ones if a request window is set
+  /// (FastLoaderConfiguration::requestWindow) [default 0]
+  void requestAllViews(size_t level = 0, bool noCache = false, int priority = 0) {
     if (finishRequestingTiles_) { return; }
+    if (requestScheduler_) {
+      requestScheduler_->submit(priority, allViewsGenerator(level, noCache, priority));
+      return;
+    }
     for (std::shared_ptr<IndexRequest> const &indexRequest : generateIndexRequestForAllViews(level)) {
-      this->pushData(indexRequest);
+      indexRequest->noCache_ = noCache;
+      indexRequest->priority_ = priority;
+      registerRequest(indexRequest);
+      submitRequest(indexRequest);
     }
   }
 
+  /// @brief Cancel the pending requests of a level
+  /// @details See RequestHandle::cancel, the views already sent are not affected.
+  /// @param level Pyramidal level
+  /// @return Number of requests cancelled
+  size_t cancelRequests(size_t level) {
+    std::lock_guard<std::mutex> lock(requestHandlesMutex_);
+    size_t nbCancelled = 0;
+    for (auto const &weakHandle : requestHandles_) {
+      if (auto handle = weakHandle.lock(); handle && handle->level() == level && handle->cancel()) { ++nbCancelled; }
+    }
+    return nbCancelled;
+  }
+
+  /// @brief Cancel the pending requests of a level covering a part of a region, e.g. when a viewer pans away from it
+  /// @details See RequestHandle::cancel, the views already sent are not affected.
+  /// @param level Pyramidal level
+  /// @param origin Region origin, global position
+  /// @param extent Region extent
+  /// @return Number of requests cancelled
+  size_t cancelRequests(size_t level, std::vector<size_t> const &origin, std::vector<size_t> const &extent) {
+    std::lock_guard<std::mutex> lock(requestHandlesMutex_);
+    size_t nbCancelled = 0;
+    for (auto const &weakHandle : requestHandles_) {
+      if (auto handle = weakHandle.lock();
+          handle && handle->level() == level && handle->intersects(origin, extent) && handle->cancel()) {
+        ++nbCancelled;
+      }
+    }
+    return nbCancelled;
+  }
+
+  /// @brief Get the next batch of views, blocking until the views of a batch are available
+  /// @details Gather the views sent in a row by the graph for a batch, should not be mixed with getBlockingResult
+  /// @return The next batch of views, nullptr if the graph has terminated
+  std::shared_ptr<ViewBatch<typename ViewType::data_t>> getBlockingBatch()
+  requires std::is_base_of_v<BatchedView<typename ViewType::data_t>, ViewType> {
+    std::vector<std::shared_ptr<BatchedView<typename ViewType::data_t>>> views{};
+    while (auto viewVariant = this->getBlockingResult()) {
+      views.push_back(std::get<std::shared_ptr<ViewType>>(*viewVariant));
+      if (views.size() == views.front()->batchSize()) {
+        return std::make_shared<ViewBatch<typename ViewType::data_t>>(std::move(views));
+      }
+    }
+    return nullptr;
+  }
+
   /// @brief Indicate no more view will be requested
   void finishRequestingViews() {
     if (!finishRequestingTiles_) {
       finishRequestingTiles_ = true;
-      this->finishPushingData();
+      if (requestScheduler_) { requestScheduler_->finish(); }
+      else { this->finishPushingData(); }
     }
   }
 
@@ -383,6 +722,37 @@ class FastLoaderGraph : public hh::Graph<1, IndexRequest, ViewType> {
     return std::make_shared<IndexRequest>(index, level);
   }
 
+  /// @brief Request an arbitrary region for a level, can be used when the FastLoaderGraph is embedded into another graph
+  /// @param origin Global position of the first element of the region
+  /// @param extent Region dimensions
+  /// @param level Region's level requested (default 0)
+  /// @return RegionRequest
+  /// @throw std::runtime_error If the region is not valid
+  std::shared_ptr<RegionRequest> generateRegionRequest(
+      std::vector<size_t> const &origin, std::vector<size_t> const &extent, size_t const &level = 0) {
+    if (level >= this->nbPyramidLevels_) {
+      std::ostringstream oss;
+      oss << "The level " << level << " does not exist.";
+      throw std::runtime_error(oss.str());
+    }
+    auto const &fullDims = this->fullDimensionPerLevel_->at(level);
+    auto const &tileDims = this->tileDimensionPerLevel_->at(level);
+    if (origin.size() != fullDims.size() || extent.size() != fullDims.size()) {
+      throw std::runtime_error("The region origin and extent should have the same number of dimensions as the file.");
+    }
+    std::vector<size_t> index(origin.size());
+    for (size_t dim = 0; dim < origin.size(); ++dim) {
+      if (origin.at(dim) >= fullDims.at(dim) || extent.at(dim) == 0) {
+        std::ostringstream oss;
+        oss << "The region starting at " << origin.at(dim) << " with an extent of " << extent.at(dim)
+            << " is not valid for the dimension " << dim << " of size " << fullDims.at(dim) << ".";
+        throw std::runtime_error(oss.str());
+      }
+      index.at(dim) = origin.at(dim) / tileDims.at(dim);
+    }
+    return std::make_shared<RegionRequest>(origin, extent, index, level);
+  }
+
   /// @brief Estimate the maximum memory usage used by FastLoader in bytes
   /// @return Estimate the maximum memory usage used by FastLoader in bytes
   [[nodiscard]] virtual size_t estimatedMaximumMemoryUsageMB() {
@@ -398,8 +768,10 @@ class FastLoaderGraph : public hh::Graph<1, IndexRequest, ViewType> {
 
       // Add cache size
       sum += this->configuration_->cacheCapacityMB().at(level);
-      // Add views size flowing
-      sum += this->configuration_->viewAvailablePerLevel_.at(level) * viewSizeMB;
+      // Add views size flowing, TileAliasView do not hold a buffer
+      if constexpr (!std::is_base_of<TileAliasView<typename ViewType::data_t>, ViewType>::value) {
+        sum += this->configuration_->viewAvailablePerLevel_.at(level) * viewSizeMB;
+      }
     }
     return sum;
   }
@@ -413,6 +785,326 @@ class FastLoaderGraph : public hh::Graph<1, IndexRequest, ViewType> {
     viewDimensionPerLevel_ = std::make_shared<std::vector<std::vector<size_t>>>();
   }
 
+  /// @brief Set up the NUMA placement if the configuration is NUMA aware and the machine has multiple nodes: the views
+  /// are homed on the node of the thread building the graph, and the tile loader threads are placed on the nodes
+  void setupNuma() {
+    if (!configuration_->numaAware_) { return; }
+    numaTopology_ = std::make_shared<internal::NumaTopology>();
+    if (numaTopology_->nbNodes() < 2) {
+      numaTopology_ = nullptr;
+      return;
+    }
+    configuration_->bufferAllocator_ = std::make_shared<internal::NumaBufferAllocator>(
+        configuration_->bufferAllocator_, numaTopology_, numaTopology_->currentNode());
+    tileLoader_->numaTopology_ = numaTopology_;
+  }
+
+  /// @brief Create the scheduler admitting the requests by priority if a request window is set
+  void createRequestScheduler() {
+    if (configuration_->requestWindow_ == 0) { return; }
+    requestScheduler_ = std::make_shared<internal::RequestScheduler>(
+        configuration_->requestWindow_,
+        [this](std::shared_ptr<IndexRequest> const &request) { this->pushData(request); },
+        [this]() { this->finishPushingData(); });
+  }
+
+  /// @brief Create the handle of a request and register it to cancel the request by region
+  /// @details The handle covers the region of the request, or its central tile.
+  /// @param indexRequest Request to register
+  /// @return Handle of the request
+  std::shared_ptr<RequestHandle> registerRequest(std::shared_ptr<IndexRequest> const &indexRequest) {
+    std::vector<size_t> origin{}, extent{};
+    if (auto regionRequest = std::dynamic_pointer_cast<RegionRequest>(indexRequest)) {
+      origin = regionRequest->origin_;
+      extent = regionRequest->extent_;
+    } else {
+      auto const &fullDims = fullDimensionPerLevel_->at(indexRequest->level_);
+      auto const &tileDims = tileDimensionPerLevel_->at(indexRequest->level_);
+      for (size_t dim = 0; dim < indexRequest->index_.size(); ++dim) {
+        origin.push_back(indexRequest->index_.at(dim) * tileDims.at(dim));
+        extent.push_back(std::min(fullDims.at(dim), origin.back() + tileDims.at(dim)) - origin.back());
+      }
+    }
+    indexRequest->handle_ = std::make_shared<RequestHandle>(indexRequest->level_, origin, extent);
+    registerHandle(indexRequest->handle_);
+    return indexRequest->handle_;
+  }
+
+  /// @brief Register a handle to cancel it with cancelRequests
+  /// @details The handles are only weakly referenced, the expired ones are purged once the number of registered handles
+  /// doubles.
+  /// @param handle Handle to register
+  void registerHandle(std::shared_ptr<RequestHandle> const &handle) {
+    std::lock_guard<std::mutex> lock(requestHandlesMutex_);
+    if (requestHandles_.size() >= requestHandlesPurgeSize_) {
+      requestHandles_.remove_if([](auto const &weakHandle) {
+        auto registered = weakHandle.lock();
+        return !registered || registered->done();
+      });
+      requestHandlesPurgeSize_ = std::max((size_t) 1024, 2 * requestHandles_.size());
+    }
+    requestHandles_.push_back(handle);
+  }
+
+  /// @brief Create the generator of the requests of all the views of a level, given to the scheduler
+  /// @details The positions are computed one at a time if the traversal allows it, else the traversal is generated
+  /// once. The stream has its own handle covering no region, so cancelRequests(level) stops it.
+  /// @param level Pyramidal level
+  /// @param noCache No cache hint of the requests
+  /// @param priority Priority of the requests
+  /// @return Generator of the requests
+  internal::RequestScheduler::Generator allViewsGenerator(size_t level, bool noCache, int priority) {
+    auto const nbTiles = this->nbTilesDims(level);
+    auto const traversal = configuration_->traversal_;
+    std::shared_ptr<std::vector<std::vector<size_t>>> positions = nullptr;
+    size_t nbSteps = std::accumulate(nbTiles.cbegin(), nbTiles.cend(), (size_t) 1, std::multiplies<>());
+    if (!traversal->randomAccess()) {
+      positions = std::make_shared<std::vector<std::vector<size_t>>>(traversal->traversal(nbTiles));
+      nbSteps = positions->size();
+    }
+    auto streamHandle = std::make_shared<RequestHandle>(level, std::vector<size_t>{}, std::vector<size_t>{});
+    registerHandle(streamHandle);
+    return [this, level, noCache, priority, nbTiles, traversal, positions, nbSteps, streamHandle, step = (size_t) 0]()
+        mutable -> std::vector<std::shared_ptr<IndexRequest>> {
+      if (streamHandle->cancelled() || step == nbSteps) {
+        // The stream is done, dropped if cancelled
+        streamHandle->deliver();
+        return {};
+      }
+      auto indexRequest = std::make_shared<IndexRequest>(
+          positions ? positions->at(step) : traversal->position(nbTiles, step), level);
+      ++step;
+      indexRequest->noCache_ = noCache;
+      indexRequest->priority_ = priority;
+      registerRequest(indexRequest);
+      std::vector<std::shared_ptr<IndexRequest>> requests{};
+      if (auto previewRequest = createPreviewRequest(indexRequest)) { requests.push_back(previewRequest); }
+      requests.push_back(indexRequest);
+      return requests;
+    };
+  }
+
+  /// @brief Submit a view request, with its preview request if needed, through the scheduler if used
+  /// @details The preview request shares the handle of the view request.
+  /// @param indexRequest View request
+  void submitRequest(std::shared_ptr<IndexRequest> const &indexRequest) {
+    auto previewRequest = createPreviewRequest(indexRequest);
+    if (requestScheduler_) {
+      requestScheduler_->submit(indexRequest, previewRequest);
+    } else {
+      if (previewRequest) { this->pushData(previewRequest); }
+      this->pushData(indexRequest);
+    }
+  }
+
+  /// @brief Create the limiter of the threads of a task running at a time per level and across the levels
+  /// @param limitPerLevel Number of running threads per level, 0 for no limit
+  /// @param sharedLimit Number of running threads across the levels, 0 for no limit
+  /// @return Level thread limiter, nullptr if no limit is set
+  std::shared_ptr<internal::LevelThreadLimiter> createLevelThreadLimiter(
+      std::vector<size_t> const &limitPerLevel, size_t sharedLimit) const {
+    if (sharedLimit == 0 && std::all_of(limitPerLevel.cbegin(), limitPerLevel.cend(),
+                                        [](auto const &limit) { return limit == 0; })) {
+      return nullptr;
+    }
+    return std::make_shared<internal::LevelThreadLimiter>(limitPerLevel, sharedLimit);
+  }
+
+  /// @brief Create the cap on the copies run by the tile loader threads if set
+  /// @return Copy limiter of the tile loader, nullptr if not used
+  std::shared_ptr<internal::LevelThreadLimiter> createTileLoaderCopyLimiter() const {
+    if (configuration_->maxCopiesInTileLoader_ == 0) { return nullptr; }
+    return std::make_shared<internal::LevelThreadLimiter>(
+        std::vector<size_t>(nbPyramidLevels_, 0), configuration_->maxCopiesInTileLoader_);
+  }
+
+  /// @brief Create the auto-tuner of the number of tile loader threads loading at a time if set
+  /// @return Loader auto-tuner, nullptr if not used
+  std::shared_ptr<internal::LoaderAutoTuner> createLoaderAutoTuner() const {
+    if (!configuration_->autoTuneLoaderThreads_) { return nullptr; }
+    size_t const nbThreads = tileLoader_->numberThreads() * nbPyramidLevels_;
+    return std::make_shared<internal::LoaderAutoTuner>(
+        configuration_->autoTuneMinThreads_,
+        configuration_->autoTuneMaxThreads_ ? std::min(configuration_->autoTuneMaxThreads_, nbThreads) : nbThreads,
+        configuration_->autoTunePeriod_);
+  }
+
+  /// @brief Number of threads of the copy task, a single one only forwarding the views if the tile loader copies
+  /// @return Number of threads of the copy task
+  [[nodiscard]] size_t nbThreadsCopy() const {
+    return configuration_->maxCopiesInTileLoader_ ? 1 : configuration_->nbThreadsCopyPhysicalCacheView();
+  }
+
+  /// @brief Create the preview request of a view request if previews are sent for its level
+  /// @param indexRequest View request
+  /// @return Preview request sharing the handle of the view request, nullptr if no preview is sent
+  std::shared_ptr<IndexRequest> createPreviewRequest(std::shared_ptr<IndexRequest> const &indexRequest) {
+    if (!sendPreview(indexRequest->level_)) { return nullptr; }
+    auto previewRequest = std::make_shared<PreviewRequest>(indexRequest->index_, indexRequest->level_);
+    previewRequest->handle_ = indexRequest->handle_;
+    return previewRequest;
+  }
+
+  /// @brief Create the memory manager of the views, the view pool grows up to the configured capacity if elastic
+  /// @details The sizing of the view pools is built on the first call, along with the trimming of the elastic pools.
+  /// @tparam ViewDataType Internal view's type
+  /// @param viewSizePerLevel Number of elements of a view per level
+  /// @param elastic True if the view pool can grow and shrink, false for the views that do not own their buffer
+  /// [default true]
+  /// @return Memory manager of the views
+  template<class ViewDataType>
+  std::shared_ptr<internal::FastLoaderMemoryManager<ViewDataType>> createMemoryManager(
+      std::vector<size_t> const &viewSizePerLevel, bool elastic = true) {
+    if (!viewPoolPolicy_) { createViewPoolPolicy(viewSizePerLevel, elastic); }
+    return std::make_shared<internal::FastLoaderMemoryManager<ViewDataType>>(
+        configuration_->viewAvailablePerLevel_, viewSizePerLevel, configuration_->nbReleasePyramid_,
+        configuration_->bufferAllocator_, viewPoolPolicy_);
+  }
+
+  /// @brief Create the sizing of the view pools, and if a pool is elastic, wake the pools when the tile loaders go idle
+  /// and trim them periodically
+  /// @param viewSizePerLevel Number of elements of a view per level
+  /// @param elastic True if the view pools can grow and shrink
+  void createViewPoolPolicy(std::vector<size_t> const &viewSizePerLevel, bool elastic) {
+    viewPoolPolicy_ = std::make_shared<internal::ViewPoolPolicy>();
+    bool anyElastic = false;
+    for (size_t level = 0; level < nbPyramidLevels_; ++level) {
+      auto const viewAvailable = configuration_->viewAvailablePerLevel_.at(level);
+      auto const viewSizeMB =
+          (double) (viewSizePerLevel.at(level) * sizeof(typename ViewType::data_t)) / (1024. * 1024.);
+      viewPoolPolicy_->maxViewsPerLevel.push_back(
+          elastic ? std::max(viewAvailable, (size_t) ((double) configuration_->viewPoolCapacityMB_.at(level) / viewSizeMB))
+                  : viewAvailable);
+      viewPoolPolicy_->maxBufferSizePerLevel.push_back(std::max(
+          viewSizePerLevel.at(level),
+          configuration_->regionBufferCapacityMB_.at(level) * 1024 * 1024 / sizeof(typename ViewType::data_t)));
+      viewPoolPolicy_->countersPerLevel.push_back(std::make_shared<internal::ViewPoolCounters>());
+      anyElastic |= viewPoolPolicy_->maxViewsPerLevel.back() > viewAvailable;
+    }
+    viewPoolPolicy_->idleTimeout = configuration_->viewPoolIdleTimeout_;
+    // The tile loader is not owned by the policy, the memory managers would keep the caches alive past the graph
+    viewPoolPolicy_->pipelineIdle = [tileLoader = std::weak_ptr<AbstractTileLoader<ViewType>>(tileLoader_)]() {
+      auto const loader = tileLoader.lock();
+      return !loader || !loader->loadingLiveRequests();
+    };
+    if (anyElastic) {
+      *tileLoader_->pipelineIdleListener_ = [policy = std::weak_ptr<internal::ViewPoolPolicy>(viewPoolPolicy_)]() {
+        if (auto const viewPoolPolicy = policy.lock()) { viewPoolPolicy->wakePools(); }
+      };
+      viewPoolTrimmer_ = std::make_unique<internal::ViewPoolTrimmer>(viewPoolPolicy_);
+    }
+  }
+
+  /// @brief Create an initialized copy of the tile loader, to load tiles outside of the graph
+  /// @return Copy of the tile loader sharing the caches
+  /// @throw std::runtime_error If the tile loader can not be copied
+  std::shared_ptr<AbstractTileLoader<ViewType>> standaloneTileLoader() const {
+    auto tileLoader = std::dynamic_pointer_cast<AbstractTileLoader<ViewType>>(tileLoader_->copy());
+    tileLoader->initializeTileLoader();
+    return tileLoader;
+  }
+
+  /// @brief Get the tile loader cache of a level after testing a range of tile indices
+  /// @param level Pyramidal level
+  /// @param begin Index of the first tile
+  /// @param end Index past the last tile, for every dimension
+  /// @return Tile loader cache of the level
+  /// @throw std::runtime_error If the level or the range is not valid
+  std::shared_ptr<internal::Cache<typename ViewType::data_t>> const &pinnedCache(
+      size_t level, std::vector<size_t> const &begin, std::vector<size_t> const &end) const {
+    if (level >= tileLoader_->allCaches_->size()) {
+      std::ostringstream oss;
+      oss << "The level " << level << " does not exist.";
+      throw std::runtime_error(oss.str());
+    }
+    auto const &cache = tileLoader_->allCaches_->at(level);
+    if (begin.size() != end.size() || !cache->isValidIndex(begin)
+        || !std::equal(begin.cbegin(), begin.cend(), end.cbegin(), std::less<>())
+        || !cache->isValidIndex(lastTileIndex(end))) {
+      throw std::runtime_error("The tile index range is not valid for the level " + std::to_string(level) + ".");
+    }
+    return cache;
+  }
+
+  /// @brief Index of the last tile of a range
+  /// @param end Index past the last tile
+  /// @return Index of the last tile
+  static std::vector<size_t> lastTileIndex(std::vector<size_t> end) {
+    for (auto &position : end) { if (position > 0) { --position; } }
+    return end;
+  }
+
+  /// @brief Move to the next tile index of a range, in row major order
+  /// @param index Current index, updated
+  /// @param begin Index of the first tile
+  /// @param end Index past the last tile
+  /// @return False once the whole range has been visited
+  static bool nextTileIndex(std::vector<size_t> &index, std::vector<size_t> const &begin,
+                            std::vector<size_t> const &end) {
+    for (size_t dim = index.size(); dim-- > 0;) {
+      if (++index.at(dim) < end.at(dim)) { return true; }
+      index.at(dim) = begin.at(dim);
+    }
+    return false;
+  }
+
+  /// @brief Start preloading the tiles of the warm start snapshot if set and available
+  /// @throw std::runtime_error If the tile loader can not be copied
+  void startWarmStart() {
+    if (configuration_->warmStartSnapshot_.empty()) { return; }
+    auto snapshot = internal::CacheWarmer<typename ViewType::data_t>::load(configuration_->warmStartSnapshot_);
+    if (snapshot.empty()) { return; }
+    auto tileLoader = standaloneTileLoader();
+    cacheWarmer_ = std::make_unique<internal::CacheWarmer<typename ViewType::data_t>>(
+        std::move(snapshot), tileLoader_->allCaches_,
+        [tileLoader](auto const &tile, std::vector<size_t> const &index, size_t level) {
+          tileLoader->loadTileFromFile(tile->data(), index, level);
+        },
+        [liveTileLoader = tileLoader_]() { return liveTileLoader->loadingLiveRequests(); });
+  }
+
+  /// @brief Create the compressed cache tier of a level if its capacity is set
+  /// @param level Pyramidal level
+  /// @return Compressed cache tier, nullptr if not used
+  std::shared_ptr<internal::CompressedCache<typename ViewType::data_t>> compressedCache(size_t level) const {
+    size_t const capacityMB = configuration_->compressedCacheCapacityMB_.at(level);
+    if (capacityMB == 0) { return nullptr; }
+    return std::make_shared<internal::CompressedCache<typename ViewType::data_t>>(capacityMB * 1024 * 1024);
+  }
+
+  /// @brief Open the persistent cache tier of a file level if its capacity is set
+  /// @details The slab file identity is made of the tile loader name, the file path, size and modification date, the
+  /// level and the geometry of its tiles, so a modified file or a different tiling does not reuse stale tiles.
+  /// @param level Pyramidal level
+  /// @param tileDimension Dimension of the tiles loaded from the file
+  /// @return Persistent cache tier, nullptr if not used or for a virtual level
+  std::shared_ptr<internal::DiskTileCache<typename ViewType::data_t>> diskCache(
+      size_t level, std::vector<size_t> const &tileDimension) const {
+    size_t const capacityMB = configuration_->diskCacheCapacityMB_.at(level);
+    if (capacityMB == 0) { return nullptr; }
+    auto virtualLevelTileLoader = std::dynamic_pointer_cast<internal::VirtualLevelTileLoader<ViewType>>(tileLoader_);
+    if (virtualLevelTileLoader && level >= virtualLevelTileLoader->nbFileLevels()) { return nullptr; }
+
+    std::ostringstream identity;
+    std::error_code errorCode;
+    auto const path = std::filesystem::weakly_canonical(tileLoader_->filePath(), errorCode);
+    identity << tileLoader_->name() << "|" << (errorCode ? tileLoader_->filePath() : path);
+    if (std::filesystem::is_regular_file(path, errorCode)) {
+      identity << "|" << std::filesystem::file_size(path, errorCode)
+               << "|" << std::filesystem::last_write_time(path, errorCode).time_since_epoch().count();
+    }
+    identity << "|" << level << "|" << sizeof(typename ViewType::data_t) << "|";
+    std::copy(fullDimensionPerLevel_->at(level).cbegin(), fullDimensionPerLevel_->at(level).cend(),
+              std::ostream_iterator<size_t>(identity, "x"));
+    identity << "|";
+    std::copy(tileDimension.cbegin(), tileDimension.cend(), std::ostream_iterator<size_t>(identity, "x"));
+
+    return std::make_shared<internal::DiskTileCache<typename ViewType::data_t>>(
+        configuration_->diskCacheDirectory_, identity.str(),
+        std::accumulate(tileDimension.cbegin(), tileDimension.cend(), (size_t) 1, std::multiplies<>()),
+        capacityMB * 1024 * 1024);
+  }
+
   /// @brief AbstractView's radii accessor
   /// @return AbstractView's radii
   [[nodiscard]] std::vector<size_t> const &radii() const { return configuration_->radii_; }
@@ -438,6 +1130,13 @@ class FastLoaderGraph : public hh::Graph<1, IndexRequest, ViewType> {
     return result;
   }
 
+  /// @brief Test if a preview should be requested before a view
+  /// @param level Pyramidal level of the view
+  /// @return True if the progressive mode is enabled and a coarser level exists, else false
+  [[nodiscard]] bool sendPreview(size_t level) const {
+    return configuration_->progressive_ && level + 1 < this->nbPyramidLevels_;
+  }
+
 };
 } // namespace fl
 
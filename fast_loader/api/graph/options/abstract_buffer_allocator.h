@@ -0,0 +1,56 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_ABSTRACT_BUFFER_ALLOCATOR_H
+#define FAST_LOADER_ABSTRACT_BUFFER_ALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+
+/// @brief FastLoader namespace
+namespace fl {
+
+/// @brief Interface to create a BufferAllocator
+/// @details Used to allocate the view buffers of the views pools (DefaultView and BatchedView) and the tile buffers of
+/// the caches, handed to the tile loader as TileBuffer.
+/// Built-in BufferAllocator:
+/// - AlignedBufferAllocator
+/// - HugePageBufferAllocator
+class AbstractBufferAllocator {
+ public:
+  /// @brief Default constructor
+  AbstractBufferAllocator() = default;
+
+  /// @brief Default destructor
+  virtual ~AbstractBufferAllocator() = default;
+
+  /// @brief Allocate a buffer
+  /// @param nbBytes Size of the buffer in bytes
+  /// @return Allocated buffer, aligned at least for any fundamental type
+  /// @throw std::bad_alloc If the buffer can not be allocated
+  [[nodiscard]] virtual void *allocate(size_t nbBytes) = 0;
+
+  /// @brief Deallocate a buffer allocated by allocate
+  /// @param buffer Buffer to deallocate
+  /// @param nbBytes Size of the buffer in bytes, as given to allocate
+  virtual void deallocate(void *buffer, size_t nbBytes) = 0;
+};
+
+} // fl
+
+#endif //FAST_LOADER_ABSTRACT_BUFFER_ALLOCATOR_H
@@ -49,6 +49,19 @@ class AbstractTraversal {
   /// @return Vector of positions
   [[nodiscard]] virtual std::vector<std::vector<size_t>> traversal(std::vector<size_t> nbTilesPerDimension) const = 0;
 
+  /// @brief Random access flag, if set the positions are computed one at a time with position, without generating the
+  /// whole traversal
+  /// @return True if position is implemented without generating the traversal [default false]
+  [[nodiscard]] virtual bool randomAccess() const { return false; }
+
+  /// @brief Compute a position of the traversal, to redefine with randomAccess for large files
+  /// @param nbTilesPerDimension Dimensions of the file
+  /// @param step Step in the traversal
+  /// @return Position at the step
+  [[nodiscard]] virtual std::vector<size_t> position(std::vector<size_t> const &nbTilesPerDimension, size_t step) const {
+    return traversal(nbTilesPerDimension).at(step);
+  }
+
 };
 
 } // fl
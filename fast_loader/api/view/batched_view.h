@@ -0,0 +1,89 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_BATCHED_VIEW_H
+#define FAST_LOADER_BATCHED_VIEW_H
+
+#include "../../core/data/view/abstract_view.h"
+#include "../../core/data/view_data/batched_view_data.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief View stored in a slot of a contiguous batch buffer [batchSize, viewDims...], for batched computation
+/// @details The views of a batch are sent in a row, ordered by slot, once the batch is complete (full, timeout or end
+/// of the stream), FastLoaderGraph::getBlockingBatch gathers them into a ViewBatch. The batch buffer is reused once
+/// all the views of the batch have been returned to the memory manager.
+/// @tparam DataType Type of data inside the View
+template<class DataType>
+class BatchedView : public internal::AbstractView<DataType> {
+ private:
+  std::shared_ptr<internal::BatchedViewData<DataType>>
+      viewData_{}; ///< Internal data of the view
+
+ public:
+  /// @brief Default constructor
+  BatchedView() = default;
+
+  /// @brief Copy constructor, the copy owns its data and is not part of a batch
+  /// @param view View to copy
+  BatchedView(BatchedView<DataType> const &view) : internal::AbstractView<DataType>(view) {
+    viewData_ = std::make_shared<internal::BatchedViewData<DataType>>(*view.viewData_.get());
+  }
+
+  /// @brief Do a deep copy of the view, calling the copy constructor
+  /// @return Copy of the view
+  std::shared_ptr<internal::AbstractView<DataType>> deepCopy() override {
+    return std::static_pointer_cast<internal::AbstractView<DataType>>(std::make_shared<fl::BatchedView<DataType>>(*this));
+  }
+
+  /// @brief ViewData accessor
+  /// @return Smart pointer to the internal view data
+  std::shared_ptr<internal::AbstractViewData<DataType>> viewData() const override {
+    return std::static_pointer_cast<internal::AbstractViewData<DataType>>(viewData_);
+  }
+
+  /// @brief ViewData setter
+  /// @param viewData View data to set
+  /// @throw std::runtime_error If the viewData is not of BatchedViewData type
+  void viewData(std::shared_ptr<internal::AbstractViewData<DataType>> const viewData) override {
+    auto viewDataCast = std::dynamic_pointer_cast<internal::BatchedViewData<DataType>>(viewData);
+    if (viewDataCast) {
+      viewData_ = viewDataCast;
+    } else {
+      throw std::runtime_error("Internal error: ViewDataType for a BatchedView is not a BatchedViewData");
+    }
+  }
+
+  /// @brief Batch data accessor
+  /// @return Pointer to the first element of the batch, the view origin for a copy
+  [[nodiscard]] DataType *batchData() const {
+    return viewData_->batch() ? viewData_->batch()->data() : this->viewOrigin();
+  }
+  /// @brief Batch size accessor
+  /// @return Number of views in the batch, 1 for a copy
+  [[nodiscard]] size_t batchSize() const {
+    return viewData_->batch() ? viewData_->batch()->nbSlotsAssigned() : 1;
+  }
+  /// @brief Index of the view in the batch accessor
+  /// @return Index of the view in the batch
+  [[nodiscard]] size_t batchIndex() const { return viewData_->slot(); }
+};
+
+} // fl
+
+#endif //FAST_LOADER_BATCHED_VIEW_H
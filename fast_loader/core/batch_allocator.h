@@ -0,0 +1,127 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_BATCH_ALLOCATOR_H
+#define FAST_LOADER_BATCH_ALLOCATOR_H
+
+#include <mutex>
+#include <list>
+#include <chrono>
+#include "data/batch_buffer.h"
+#include "data/view_data/batched_view_data.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Hand out the slots of the batch buffers to the view data, shared by all the levels
+/// @details For each level, the slots of the open batch are handed out in request order. The open batch is sealed when
+/// full, when the timeout has expired since it has been opened, or at the end of the stream. The batches are reused
+/// once all their slots have been released.
+/// @tparam DataType Type of data inside the View
+template<class DataType>
+class BatchAllocator {
+ private:
+  using Batch_t = std::shared_ptr<BatchBuffer<DataType>>; ///< Helper to define the batch type
+  size_t const batchSize_ = 1; ///< Number of views in a full batch
+  std::chrono::milliseconds const timeout_{}; ///< Timeout to seal a partially filled batch, 0 to disable it
+  std::vector<size_t> const viewSizePerLevel_{}; ///< Number of elements in a view per level
+  std::shared_ptr<AbstractBufferAllocator> const
+      bufferAllocator_ = nullptr; ///< Allocator of the batches buffers, nullptr for the default allocation
+  std::vector<Batch_t> openBatchPerLevel_{}; ///< Batch handing out slots per level
+  std::vector<std::list<Batch_t>> batchesPerLevel_{}; ///< All the batches allocated per level
+  std::mutex mutex_{}; ///< Mutex protecting the batches state
+
+ public:
+  /// @brief BatchAllocator constructor
+  /// @param batchSize Number of views in a full batch
+  /// @param timeout Timeout to seal a partially filled batch, 0 to disable it
+  /// @param viewSizePerLevel Number of elements in a view per level
+  /// @param bufferAllocator Allocator of the batches buffers, nullptr for the default allocation [default nullptr]
+  BatchAllocator(size_t batchSize, std::chrono::milliseconds timeout, std::vector<size_t> viewSizePerLevel,
+                 std::shared_ptr<AbstractBufferAllocator> bufferAllocator = nullptr)
+      : batchSize_(batchSize), timeout_(timeout), viewSizePerLevel_(std::move(viewSizePerLevel)),
+        bufferAllocator_(std::move(bufferAllocator)),
+        openBatchPerLevel_(viewSizePerLevel_.size(), nullptr), batchesPerLevel_(viewSizePerLevel_.size()) {}
+
+  /// @brief Default destructor
+  virtual ~BatchAllocator() = default;
+
+  /// @brief Batch size accessor
+  /// @return Number of views in a full batch
+  [[nodiscard]] size_t batchSize() const { return batchSize_; }
+
+  /// @brief Bind a view data to the next slot of the open batch for a level
+  /// @param viewData View data to bind
+  /// @param level Pyramidal level
+  void bind(BatchedViewData<DataType> &viewData, size_t level) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    auto &openBatch = openBatchPerLevel_.at(level);
+    if (openBatch && !openBatch->sealed() && expired(openBatch)) { openBatch->seal(); }
+    if (!openBatch || openBatch->sealed()) { openBatch = reusableBatch(level); }
+    viewData.bind(openBatch, openBatch->assignSlot());
+  }
+
+  /// @brief Test if a batch is complete, i.e. sealed with all the slots handed out received, seal it if expired
+  /// @param batch Batch to test
+  /// @param nbViewsReceived Number of views of the batch received
+  /// @return True if the batch is complete
+  bool complete(Batch_t const &batch, size_t nbViewsReceived) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    if (!batch->sealed() && expired(batch)) { batch->seal(); }
+    return batch->sealed() && nbViewsReceived == batch->nbSlotsAssigned();
+  }
+
+  /// @brief Seal all the open batches, no more views will be requested
+  void sealAll() {
+    std::lock_guard<std::mutex> lk(mutex_);
+    for (auto &openBatch : openBatchPerLevel_) {
+      if (openBatch) { openBatch->seal(); }
+    }
+  }
+
+ private:
+  /// @brief Test if the timeout has expired for a batch
+  /// @param batch Batch to test
+  /// @return True if the timeout is enabled and has expired
+  [[nodiscard]] bool expired(Batch_t const &batch) const {
+    return timeout_ != std::chrono::milliseconds::zero()
+        && std::chrono::steady_clock::now() - batch->openingTime() >= timeout_;
+  }
+
+  /// @brief Get a batch to open for a level, reuse a batch if possible, else allocate a new one
+  /// @param level Pyramidal level
+  /// @return Batch to open
+  Batch_t reusableBatch(size_t level) {
+    auto &batches = batchesPerLevel_.at(level);
+    auto batch = std::find_if(batches.begin(), batches.end(), [](auto const &b) { return b->reusable(); });
+    if (batch != batches.end()) {
+      (*batch)->reopen();
+      return *batch;
+    }
+    batches.push_back(std::make_shared<BatchBuffer<DataType>>(
+        viewSizePerLevel_.at(level), batchSize_, level, bufferAllocator_));
+    return batches.back();
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_BATCH_ALLOCATOR_H
@@ -0,0 +1,60 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_ALIGNED_BUFFER_ALLOCATOR_H
+#define FAST_LOADER_ALIGNED_BUFFER_ALLOCATOR_H
+
+#include <new>
+#include "../../api/graph/options/abstract_buffer_allocator.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Buffer allocator aligning the buffers on a cache line (64 bytes) by default
+class AlignedBufferAllocator : public AbstractBufferAllocator {
+ private:
+  std::align_val_t const alignment_{}; ///< Buffers alignment in bytes
+ public:
+  /// @brief AlignedBufferAllocator constructor
+  /// @param alignment Buffers alignment in bytes, a power of 2 [default 64]
+  explicit AlignedBufferAllocator(size_t alignment = 64) : alignment_(std::align_val_t(alignment)) {}
+
+  /// @brief Default destructor
+  ~AlignedBufferAllocator() override = default;
+
+  /// @brief Alignment accessor
+  /// @return Buffers alignment in bytes
+  [[nodiscard]] size_t alignment() const { return static_cast<size_t>(alignment_); }
+
+  /// @brief Allocate an aligned buffer
+  /// @param nbBytes Size of the buffer in bytes
+  /// @return Aligned buffer
+  [[nodiscard]] void *allocate(size_t nbBytes) override { return ::operator new(nbBytes, alignment_); }
+
+  /// @brief Deallocate an aligned buffer
+  /// @param buffer Buffer to deallocate
+  /// @param nbBytes Size of the buffer in bytes [unused]
+  void deallocate(void *buffer, [[maybe_unused]] size_t nbBytes) override { ::operator delete(buffer, alignment_); }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_ALIGNED_BUFFER_ALLOCATOR_H
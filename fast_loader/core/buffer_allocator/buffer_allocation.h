@@ -0,0 +1,63 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_BUFFER_ALLOCATION_H
+#define FAST_LOADER_BUFFER_ALLOCATION_H
+
+#include <memory>
+#include "../../api/graph/options/abstract_buffer_allocator.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Allocate a buffer of elements with a buffer allocator, or with new[] if there is none
+/// @tparam DataType Type of the elements
+/// @param bufferAllocator Buffer allocator, nullptr to use new[]
+/// @param nbElements Number of elements
+/// @return Buffer of default-initialized elements
+template<class DataType>
+DataType *allocateBuffer(std::shared_ptr<AbstractBufferAllocator> const &bufferAllocator, size_t nbElements) {
+  if (!bufferAllocator) { return new DataType[nbElements]; }
+  auto buffer = static_cast<DataType *>(bufferAllocator->allocate(nbElements * sizeof(DataType)));
+  std::uninitialized_default_construct_n(buffer, nbElements);
+  return buffer;
+}
+
+/// @brief Deallocate a buffer allocated by allocateBuffer
+/// @tparam DataType Type of the elements
+/// @param bufferAllocator Buffer allocator used to allocate the buffer, nullptr if new[] has been used
+/// @param buffer Buffer to deallocate, can be nullptr
+/// @param nbElements Number of elements
+template<class DataType>
+void deallocateBuffer(std::shared_ptr<AbstractBufferAllocator> const &bufferAllocator,
+                      DataType *buffer, size_t nbElements) {
+  if (!buffer) { return; }
+  if (!bufferAllocator) {
+    delete[] buffer;
+    return;
+  }
+  std::destroy_n(buffer, nbElements);
+  bufferAllocator->deallocate(buffer, nbElements * sizeof(DataType));
+}
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_BUFFER_ALLOCATION_H
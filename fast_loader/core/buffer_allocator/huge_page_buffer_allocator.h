@@ -0,0 +1,118 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_HUGE_PAGE_BUFFER_ALLOCATOR_H
+#define FAST_LOADER_HUGE_PAGE_BUFFER_ALLOCATOR_H
+
+#include <cstdint>
+#include "aligned_buffer_allocator.h"
+#ifdef __linux__
+#include <sys/mman.h>
+#endif //__linux__
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Buffer allocator backing the large buffers with huge pages to reduce the TLB misses
+/// @details The buffers of at least a huge page are mapped on huge page boundaries. With explicit huge pages they are
+/// taken from the reserved huge pages pool (MAP_HUGETLB), falling back to transparent huge pages if the pool is empty;
+/// else transparent huge pages are requested (madvise(MADV_HUGEPAGE)). The kernel only aligns a plain mapping on a
+/// page, so for transparent huge pages a huge page more is mapped and the mapping is trimmed to start on a huge page. Smaller buffers are only aligned on a cache
+/// line. On systems other than Linux all buffers are only aligned on a cache line.
+class HugePageBufferAllocator : public AlignedBufferAllocator {
+ private:
+  size_t const hugePageSize_ = 0; ///< Huge page size in bytes
+  bool const explicitHugePages_ = false; ///< Use the reserved huge pages pool
+ public:
+  /// @brief HugePageBufferAllocator constructor
+  /// @param explicitHugePages Use the reserved huge pages pool (MAP_HUGETLB) instead of transparent huge pages
+  /// [default false]
+  /// @param hugePageSize Huge page size in bytes [default 2MB]
+  explicit HugePageBufferAllocator(bool explicitHugePages = false, size_t hugePageSize = (size_t) 1 << 21)
+      : hugePageSize_(hugePageSize), explicitHugePages_(explicitHugePages) {}
+
+  /// @brief Default destructor
+  ~HugePageBufferAllocator() override = default;
+
+  /// @brief Huge page size accessor
+  /// @return Huge page size in bytes
+  [[nodiscard]] size_t hugePageSize() const { return hugePageSize_; }
+
+  /// @brief Explicit huge pages flag accessor
+  /// @return True if the reserved huge pages pool is used
+  [[nodiscard]] bool explicitHugePages() const { return explicitHugePages_; }
+
+  /// @brief Allocate a buffer, backed by huge pages if it is at least a huge page
+  /// @param nbBytes Size of the buffer in bytes
+  /// @return Allocated buffer
+  /// @throw std::bad_alloc If the buffer can not be allocated
+  [[nodiscard]] void *allocate(size_t nbBytes) override {
+#ifdef __linux__
+    if (nbBytes >= hugePageSize_) {
+      size_t const mappedSize = roundUp(nbBytes);
+      void *buffer = MAP_FAILED;
+      if (explicitHugePages_) {
+        buffer = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      }
+      if (buffer == MAP_FAILED) {
+        void *mapping =
+            mmap(nullptr, mappedSize + hugePageSize_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping == MAP_FAILED) { throw std::bad_alloc(); }
+        // Trim the mapping before the first huge page boundary and after the buffer
+        auto const begin = reinterpret_cast<uintptr_t>(mapping), aligned = roundUp(begin);
+        if (aligned > begin) { munmap(mapping, aligned - begin); }
+        if (hugePageSize_ > aligned - begin) {
+          munmap(reinterpret_cast<void *>(aligned + mappedSize), hugePageSize_ - (aligned - begin));
+        }
+        buffer = reinterpret_cast<void *>(aligned);
+        madvise(buffer, mappedSize, MADV_HUGEPAGE);
+      }
+      return buffer;
+    }
+#endif //__linux__
+    return AlignedBufferAllocator::allocate(nbBytes);
+  }
+
+  /// @brief Deallocate a buffer allocated by allocate
+  /// @param buffer Buffer to deallocate
+  /// @param nbBytes Size of the buffer in bytes, as given to allocate
+  void deallocate(void *buffer, size_t nbBytes) override {
+#ifdef __linux__
+    if (nbBytes >= hugePageSize_) {
+      munmap(buffer, roundUp(nbBytes));
+      return;
+    }
+#endif //__linux__
+    AlignedBufferAllocator::deallocate(buffer, nbBytes);
+  }
+
+ private:
+  /// @brief Round up a size or an address to a multiple of the huge page size
+  /// @param value Size or address
+  /// @return Rounded value
+  [[nodiscard]] size_t roundUp(size_t value) const {
+    return (value + hugePageSize_ - 1) / hugePageSize_ * hugePageSize_;
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_HUGE_PAGE_BUFFER_ALLOCATOR_H
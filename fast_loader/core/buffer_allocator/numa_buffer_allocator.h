@@ -0,0 +1,77 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_NUMA_BUFFER_ALLOCATOR_H
+#define FAST_LOADER_NUMA_BUFFER_ALLOCATOR_H
+
+#include <new>
+#include "../../api/graph/options/abstract_buffer_allocator.h"
+#include "../numa_topology.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Buffer allocator homing the buffers on a NUMA node
+/// @details The buffers are allocated by the wrapped allocator, or with the default allocation if there is none, and
+/// are then bound to the node.
+class NumaBufferAllocator : public AbstractBufferAllocator {
+ private:
+  std::shared_ptr<AbstractBufferAllocator> const allocator_ = nullptr; ///< Wrapped allocator, nullptr for the default
+  std::shared_ptr<NumaTopology> const numaTopology_ = nullptr; ///< NUMA topology
+  size_t const node_ = 0; ///< Node homing the buffers
+
+ public:
+  /// @brief NumaBufferAllocator constructor
+  /// @param allocator Wrapped allocator, nullptr for the default allocation
+  /// @param numaTopology NUMA topology
+  /// @param node Node homing the buffers
+  NumaBufferAllocator(std::shared_ptr<AbstractBufferAllocator> allocator,
+                      std::shared_ptr<NumaTopology> numaTopology, size_t node)
+      : allocator_(std::move(allocator)), numaTopology_(std::move(numaTopology)), node_(node) {}
+
+  /// @brief Default destructor
+  ~NumaBufferAllocator() override = default;
+
+  /// @brief Node accessor
+  /// @return Node homing the buffers
+  [[nodiscard]] size_t node() const { return node_; }
+
+  /// @brief Allocate a buffer homed on the node
+  /// @param nbBytes Size of the buffer in bytes
+  /// @return Allocated buffer
+  [[nodiscard]] void *allocate(size_t nbBytes) override {
+    void *buffer = allocator_ ? allocator_->allocate(nbBytes) : ::operator new(nbBytes);
+    numaTopology_->bindMemory(buffer, nbBytes, node_);
+    return buffer;
+  }
+
+  /// @brief Deallocate a buffer allocated by allocate
+  /// @param buffer Buffer to deallocate
+  /// @param nbBytes Size of the buffer in bytes
+  void deallocate(void *buffer, size_t nbBytes) override {
+    if (allocator_) { allocator_->deallocate(buffer, nbBytes); }
+    else { ::operator delete(buffer); }
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_NUMA_BUFFER_ALLOCATOR_H
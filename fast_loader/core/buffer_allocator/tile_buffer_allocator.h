@@ -0,0 +1,92 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_TILE_BUFFER_ALLOCATOR_H
+#define FAST_LOADER_TILE_BUFFER_ALLOCATOR_H
+
+#include <memory>
+#include "../../api/graph/options/abstract_buffer_allocator.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Standard allocator forwarding the allocations of the tile buffers to a buffer allocator
+/// @details A default constructed allocator, or one without buffer allocator, uses the default allocation. The
+/// allocator is not propagated on assignment or swap, so a tile buffer keeps its allocation when data are assigned to
+/// it.
+/// @tparam DataType Type of the elements
+template<class DataType>
+class TileBufferAllocator {
+ private:
+  std::shared_ptr<AbstractBufferAllocator> bufferAllocator_ = nullptr; ///< Buffer allocator, nullptr for the default
+
+ public:
+  using value_type = DataType; ///< Type of the elements
+
+  /// @brief Default constructor, using the default allocation
+  TileBufferAllocator() = default;
+
+  /// @brief TileBufferAllocator constructor
+  /// @param bufferAllocator Buffer allocator, nullptr for the default allocation
+  explicit TileBufferAllocator(std::shared_ptr<AbstractBufferAllocator> bufferAllocator)
+      : bufferAllocator_(std::move(bufferAllocator)) {}
+
+  /// @brief Rebinding constructor
+  /// @tparam OtherType Type of the elements of the other allocator
+  /// @param other Allocator sharing its buffer allocator
+  template<class OtherType>
+  TileBufferAllocator(TileBufferAllocator<OtherType> const &other)
+      : bufferAllocator_(other.bufferAllocator()) {}
+
+  /// @brief Buffer allocator accessor
+  /// @return Buffer allocator, nullptr for the default allocation
+  [[nodiscard]] std::shared_ptr<AbstractBufferAllocator> const &bufferAllocator() const { return bufferAllocator_; }
+
+  /// @brief Allocate a buffer of elements
+  /// @param nbElements Number of elements
+  /// @return Allocated buffer
+  /// @throw std::bad_alloc If the buffer can not be allocated
+  [[nodiscard]] DataType *allocate(size_t nbElements) {
+    if (!bufferAllocator_) { return std::allocator<DataType>().allocate(nbElements); }
+    return static_cast<DataType *>(bufferAllocator_->allocate(nbElements * sizeof(DataType)));
+  }
+
+  /// @brief Deallocate a buffer allocated by allocate
+  /// @param buffer Buffer to deallocate
+  /// @param nbElements Number of elements, as given to allocate
+  void deallocate(DataType *buffer, size_t nbElements) {
+    if (!bufferAllocator_) { std::allocator<DataType>().deallocate(buffer, nbElements); }
+    else { bufferAllocator_->deallocate(buffer, nbElements * sizeof(DataType)); }
+  }
+
+  /// @brief Equality operator, the buffers of an allocator can be deallocated by an equal one
+  /// @tparam OtherType Type of the elements of the other allocator
+  /// @param other Allocator to compare with
+  /// @return True if both allocators use the same buffer allocator
+  template<class OtherType>
+  bool operator==(TileBufferAllocator<OtherType> const &other) const {
+    return bufferAllocator_ == other.bufferAllocator();
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_TILE_BUFFER_ALLOCATOR_H
@@ -25,7 +25,13 @@
 #include <chrono>
 #include <utility>
 #include <algorithm>
+#include <optional>
 #include "data/cached_tile.h"
+#include "numa_topology.h"
+#include "compression/compressed_cache.h"
+#include "disk_tile_cache.h"
+#include "frequency_sketch.h"
+#include "../api/data/data_type.h"
 
 
 /// @brief FastLoader namespace
@@ -46,13 +52,27 @@ class Cache {
     maxNbTilesCache_{}, ///< Maximum number tiles in cache
     nbTilesCache_{}; ///< Number tiles in cache
   std::vector<CachedTile_t> mapCache_{}; ///< Map between the Tile and its position
-  std::queue<CachedTile_t> pool_{}; ///< Pool of available tile
+  size_t nbPartitions_ = 1; ///< Number of partitions, one per NUMA node, a tile is homed by its index hash
+  std::vector<std::queue<CachedTile_t>> pools_{}; ///< Pool of available tile per partition
+  std::vector<bool> pinned_{}; ///< Pinned flag per flattened index, a pinned tile is never evicted
+  std::vector<size_t>
+      nbTilesPerPartition_{}, ///< Number of tiles per partition
+      nbPinnedPerPartition_{}; ///< Number of pinned indices per partition
+  size_t
+      nbPinnableTiles_ = 0, ///< Pinned budget, maximum number of pinned indices
+      nbPinnedTiles_ = 0; ///< Number of pinned indices
   std::list<CachedTile_t> lru_{}; ///< List to save the Tile order
   std::unordered_map<CachedTile_t, typename std::list<CachedTile_t>::const_iterator> mapLRU_{}; ///< Map between the Tile and it's position
   std::mutex cacheMutex_{}; ///< Cache mutex
+  std::shared_ptr<std::atomic<size_t>>
+      nbReleases_ = std::make_shared<std::atomic<size_t>>(0); ///< Counter of tiles releases, waited on to recycle a tile
+  std::shared_ptr<CompressedCache<DataType>> compressedCache_ = nullptr; ///< Second tier, nullptr if not used
+  std::shared_ptr<DiskTileCache<DataType>> diskCache_ = nullptr; ///< Persistent tier, nullptr if not used
+  std::unique_ptr<FrequencySketch> frequencySketch_ = nullptr; ///< Access frequencies for TinyLFU, nullptr if not used
   std::size_t
     miss_{}, ///< Number of tile miss (tile get from the disk)
-    hit_{};  ///< Number of tile hit (tile get from the cache)
+    hit_{},  ///< Number of tile hit (tile get from the cache)
+    declined_{}; ///< Number of missed tiles not admitted, inserted as the least recently used tile
 
   std::chrono::nanoseconds
       accessTime_ = std::chrono::nanoseconds::zero(), ///< Time to get a tile from the cache (use for statistics)
@@ -63,17 +83,47 @@ class Cache {
   /// @param cacheDimension Cache dimensions
   /// @param nbTilesCache Number tiles in cache
   /// @param tileDimension Tile dimensions
-  Cache(std::vector<size_t> cacheDimension, size_t nbTilesCache, std::vector<size_t> tileDimension) :
+  /// @param bufferAllocator Buffer allocator of the tiles buffers, nullptr for the default allocation [default nullptr]
+  /// @param numaTopology NUMA topology, if set the cache is partitioned per node, nullptr for none [default nullptr]
+  /// @param compressedCache Compressed second tier holding the evicted tiles, nullptr for none [default nullptr]
+  /// @param diskCache Persistent tier holding the tiles loaded from the file, nullptr for none [default nullptr]
+  /// @param nbPinnableTiles Pinned budget, maximum number of pinned tiles, bounded to keep at least one evictable tile
+  /// per partition [default 0]
+  /// @param admissionType Admission of the missed tiles [default CacheAdmissionType::ALWAYS]
+  Cache(std::vector<size_t> cacheDimension, size_t nbTilesCache, std::vector<size_t> tileDimension,
+        std::shared_ptr<AbstractBufferAllocator> const &bufferAllocator = nullptr,
+        std::shared_ptr<NumaTopology> const &numaTopology = nullptr,
+        std::shared_ptr<CompressedCache<DataType>> compressedCache = nullptr,
+        std::shared_ptr<DiskTileCache<DataType>> diskCache = nullptr,
+        size_t nbPinnableTiles = 0,
+        CacheAdmissionType admissionType = CacheAdmissionType::ALWAYS) :
       cacheDimension_(std::move(cacheDimension)),
       maxNbTilesCache_(std::accumulate(cacheDimension_.begin(), cacheDimension_.end(), (size_t) 1, std::multiplies<>())),
       nbTilesCache_(
           nbTilesCache == 0 ?
           (maxNbTilesCache_ < 18 ? maxNbTilesCache_ : 18) :
           (maxNbTilesCache_ < nbTilesCache ? maxNbTilesCache_ : nbTilesCache)
-      ) {
+      ), compressedCache_(std::move(compressedCache)), diskCache_(std::move(diskCache)) {
     mapCache_ = std::vector<CachedTile_t>(maxNbTilesCache_);
+    if (numaTopology) { nbPartitions_ = std::max((size_t) 1, std::min(numaTopology->nbNodes(), nbTilesCache_)); }
+    pools_ = std::vector<std::queue<CachedTile_t>>(nbPartitions_);
+    nbTilesPerPartition_ = std::vector<size_t>(nbPartitions_, 0);
+    nbPinnedPerPartition_ = std::vector<size_t>(nbPartitions_, 0);
+    pinned_ = std::vector<bool>(maxNbTilesCache_, false);
+    nbPinnableTiles_ = std::min(nbPinnableTiles, nbTilesCache_ - nbPartitions_);
+    if (admissionType == CacheAdmissionType::TINY_LFU) {
+      frequencySketch_ = std::make_unique<FrequencySketch>(nbTilesCache_);
+    }
     for (size_t tileCnt = 0; tileCnt < nbTilesCache_; ++tileCnt) {
-      pool_.push(std::make_shared<CachedTile<DataType>>(tileDimension));
+      auto tile = std::make_shared<CachedTile<DataType>>(tileDimension, bufferAllocator);
+      size_t const partition = tileCnt % nbPartitions_;
+      tile->partition(partition);
+      tile->releasesCounter(nbReleases_);
+      if (nbPartitions_ > 1) {
+        numaTopology->bindMemory(tile->data()->data(), tile->data()->size() * sizeof(DataType), partition);
+      }
+      pools_.at(partition).push(tile);
+      ++nbTilesPerPartition_.at(partition);
     }
   }
 
@@ -89,12 +139,31 @@ class Cache {
   /// @brief Cache hit accessor
   /// @return Cache hit counter
   [[nodiscard]] size_t hit() const { return hit_; }
+  /// @brief Declined admissions accessor
+  /// @return Number of missed tiles not admitted, inserted as the least recently used tile
+  [[nodiscard]] size_t declined() const { return declined_; }
   /// @brief Matrix of cached tiles accessor
   /// @return Matrix of cached tiles
   std::vector<CachedTile_t> const &mapCache() const { return mapCache_; }
+  /// @brief Number of partitions accessor
+  /// @return Number of partitions, one per NUMA node
+  [[nodiscard]] size_t nbPartitions() const { return nbPartitions_; }
   /// @brief Pool accessor
-  /// @return Pool of available tile
-  std::queue<CachedTile_t> const &pool() const { return pool_; }
+  /// @param partition Partition [default 0]
+  /// @return Pool of available tile of the partition
+  std::queue<CachedTile_t> const &pool(size_t partition = 0) const { return pools_.at(partition); }
+  /// @brief Compressed second tier accessor
+  /// @return Compressed second tier, nullptr if not used
+  std::shared_ptr<CompressedCache<DataType>> const &compressedCache() const { return compressedCache_; }
+  /// @brief Persistent tier accessor
+  /// @return Persistent tier, nullptr if not used
+  std::shared_ptr<DiskTileCache<DataType>> const &diskCache() const { return diskCache_; }
+  /// @brief Pinned budget accessor
+  /// @return Maximum number of pinned tiles
+  [[nodiscard]] size_t nbPinnableTiles() const { return nbPinnableTiles_; }
+  /// @brief Number of pinned tiles accessor
+  /// @return Number of pinned tiles
+  [[nodiscard]] size_t nbPinnedTiles() const { return nbPinnedTiles_; }
   /// @brief Tile order accessor
   /// @return Tile order
   std::list<CachedTile_t> const &lru() const { return lru_; }
@@ -106,22 +175,35 @@ class Cache {
   [[nodiscard]] std::chrono::nanoseconds const &recycleTime() const { return recycleTime_; }
 
   /// @brief Get a locked tile from its index
+  /// @details A missed tile is admitted as the most recently used tile, unless the no cache hint is set or the TinyLFU
+  /// admission estimates it is accessed less often than the tile it evicts. A tile not admitted still gets a cache slot
+  /// to be loaded in, but is inserted as the least recently used tile, so a scan recycles the same slots instead of
+  /// flushing the cache. The cache is never locked while waiting for a tile in use, a tile being held for a long time
+  /// does not block the requests of the other tiles.
   /// @param index Tile index
+  /// @param noCache Hint to not admit the tile if missed, and not to count the access in the frequencies [default false]
   /// @return Locked tile corresponding to the requested index
-  CachedTile_t lockedTile(std::vector<size_t> const &index) {
+  CachedTile_t lockedTile(std::vector<size_t> const &index, bool noCache = false) {
     assert(testIndex(index));
-    CachedTile_t tile;
+    CachedTile_t tile = nullptr;
     this->lockCache();
     auto begin = std::chrono::system_clock::now();
-    if (isInCache(index)) {
-      // Tile is in cache
-      hit_ += 1;
-      tile = cachedLockedTile(index);
-    } else {
-      // Tile is not in the cache
-      miss_ += 1;
-      if (pool_.empty()) { recycleTile(); }
-      tile = newLockedTile(index);
+    size_t const flatIndex = mapIndex(index);
+    if (frequencySketch_ && !noCache) { frequencySketch_->increment(flatIndex); }
+    // The cache is unlocked while waiting for a tile, so it is looked up again until a tile is acquired
+    while (!tile) {
+      if (isInCache(index)) {
+        // Tile is in cache
+        if ((tile = cachedLockedTile(index))) { hit_ += 1; }
+      } else {
+        // Tile is not in the cache
+        size_t const partition = flatIndex % nbPartitions_;
+        bool admitted = !noCache;
+        if (pools_.at(partition).empty() && !recycleTile(partition, flatIndex, admitted)) { continue; }
+        miss_ += 1;
+        if (!admitted) { declined_ += 1; }
+        tile = newLockedTile(index, partition, admitted);
+      }
     }
     auto end = std::chrono::system_clock::now();
     accessTime_ += std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
@@ -129,6 +211,140 @@ class Cache {
     return tile;
   }
 
+  /// @brief Get a new locked tile to preload, only if the tile is not in cache and a free tile is available
+  /// @details The tile is never taken by evicting another one, and the hit / miss counters are not updated
+  /// @param index Tile index
+  /// @return New tile with its semaphore acquired, nullptr if the tile is in cache or no free tile is available
+  CachedTile_t preloadTile(std::vector<size_t> const &index) {
+    CachedTile_t tile = nullptr;
+    this->lockCache();
+    size_t const partition = mapIndex(index) % nbPartitions_;
+    if (!isInCache(index) && !pools_.at(partition).empty()) { tile = newLockedTile(index, partition); }
+    this->unlockCache();
+    return tile;
+  }
+
+  /// @brief Test if a free tile is available without evicting a tile
+  /// @return True if a free tile is available
+  [[nodiscard]] bool hasFreeTile() {
+    this->lockCache();
+    bool const hasFreeTile =
+        std::any_of(pools_.cbegin(), pools_.cend(), [](auto const &pool) { return !pool.empty(); });
+    this->unlockCache();
+    return hasFreeTile;
+  }
+
+  /// @brief Test if an index is valid without throwing
+  /// @param index Index to test
+  /// @return True if the index has the cache number of dimensions and is inside the cache dimensions
+  [[nodiscard]] bool isValidIndex(std::vector<size_t> const &index) const {
+    if (index.size() != cacheDimension_.size()) { return false; }
+    for (size_t dim = 0; dim < index.size(); ++dim) { if (index.at(dim) >= cacheDimension_.at(dim)) { return false; } }
+    return true;
+  }
+
+  /// @brief Indices of the resident tiles
+  /// @return Indices of the tiles in cache, most recently used first
+  [[nodiscard]] std::vector<std::vector<size_t>> residentIndices() {
+    std::vector<std::vector<size_t>> indices;
+    this->lockCache();
+    indices.reserve(lru_.size());
+    for (auto const &tile : lru_) { indices.push_back(tile->index()); }
+    this->unlockCache();
+    return indices;
+  }
+
+  /// @brief Pin a tile, a pinned tile is never evicted once loaded
+  /// @details The pin is set on the index, the tile does not need to be in cache. The pinned budget is shared by all
+  /// the tiles, and each partition keeps at least one evictable tile so the requests of unpinned tiles can progress.
+  /// @param index Tile index
+  /// @return True if the tile is pinned, false if the pinned budget is exhausted
+  bool pin(std::vector<size_t> const &index) {
+    assert(testIndex(index));
+    bool pinned = true;
+    this->lockCache();
+    size_t const flatIndex = mapIndex(index), partition = flatIndex % nbPartitions_;
+    if (!pinned_.at(flatIndex)) {
+      if (nbPinnedTiles_ < nbPinnableTiles_
+          && nbPinnedPerPartition_.at(partition) + 1 < nbTilesPerPartition_.at(partition)) {
+        pinned_.at(flatIndex) = true;
+        ++nbPinnedTiles_;
+        ++nbPinnedPerPartition_.at(partition);
+      } else { pinned = false; }
+    }
+    this->unlockCache();
+    return pinned;
+  }
+
+  /// @brief Unpin a tile, the tile stays in cache and is evicted following the LRU order
+  /// @param index Tile index
+  void unpin(std::vector<size_t> const &index) {
+    assert(testIndex(index));
+    this->lockCache();
+    size_t const flatIndex = mapIndex(index);
+    if (pinned_.at(flatIndex)) {
+      pinned_.at(flatIndex) = false;
+      --nbPinnedTiles_;
+      --nbPinnedPerPartition_.at(flatIndex % nbPartitions_);
+    }
+    this->unlockCache();
+  }
+
+  /// @brief Test if a tile is pinned
+  /// @param index Tile index
+  /// @return True if the tile is pinned
+  [[nodiscard]] bool isPinned(std::vector<size_t> const &index) {
+    assert(testIndex(index));
+    this->lockCache();
+    bool const pinned = pinned_.at(mapIndex(index));
+    this->unlockCache();
+    return pinned;
+  }
+
+  /// @brief Save the evicted data still in a new tile buffer to the compressed tier, then try to restore the tile from
+  /// the compressed tier, then from the persistent tier
+  /// @details To call on a new tile, with its mutex locked, before loading it from the file. The compression,
+  /// decompression and disk accesses are done outside the cache lock.
+  /// @param tile New tile
+  /// @return True if the tile has been restored, else false and the tile needs to be loaded from the file
+  bool restoreTile(CachedTile_t const &tile) {
+    auto &data = *tile->data();
+    if (compressedCache_) {
+      if (tile->holdsEvictedData()) {
+        compressedCache_->store(tile->evictedIndex(), data.data(), data.size());
+        tile->clearEvicted();
+      }
+      if (compressedCache_->load(mapIndex(tile->index()), data.data(), data.size())) { return true; }
+    }
+    return diskCache_ && diskCache_->load(mapIndex(tile->index()), data.data(), data.size());
+  }
+
+  /// @brief Save a tile loaded from the file to the persistent tier
+  /// @details To call on a tile, with its mutex locked, after loading it from the file
+  /// @param tile Tile loaded from the file
+  void saveTile(CachedTile_t const &tile) {
+    if (diskCache_) { diskCache_->store(mapIndex(tile->index()), tile->data()->data(), tile->data()->size()); }
+  }
+
+  /// @brief Get a locked tile from its index only if it is already loaded and not in use, never block nor load
+  /// @details The tile order in the LRU and the hit / miss counters are not updated
+  /// @param index Tile index
+  /// @return Locked tile corresponding to the requested index, nullptr if not available
+  CachedTile_t tryLockedTile(std::vector<size_t> const &index) {
+    assert(testIndex(index));
+    CachedTile_t tile = nullptr;
+    this->lockCache();
+    if (isInCache(index) && mapCache_.at(mapIndex(index))->tryAcquireSemaphore()) {
+      tile = mapCache_.at(mapIndex(index));
+      if (tile->newTile()) {
+        tile->releaseSemaphore();
+        tile = nullptr;
+      }
+    }
+    this->unlockCache();
+    return tile;
+  }
+
  private:
   /// \brief Lock the cache.
   void lockCache() { cacheMutex_.lock(); }
@@ -173,14 +389,21 @@ class Cache {
   }
 
   /// @brief Get a cached tile
+  /// @details If the tile is in use, the cache is unlocked while waiting for it, and the cache needs to be looked up
+  /// again as the tile may have been recycled in the meantime
   /// @param index Tile's index
-  /// @return The cached tile
+  /// @return The cached tile, nullptr if the tile was in use
   [[nodiscard]] CachedTile_t cachedLockedTile(std::vector<size_t> const &index) {
     assert(isInCache(index));
 
     // Get the tile
-    CachedTile_t tile = mapCache_.at(mapIndex(index));    
-    tile->acquireSemaphore();
+    CachedTile_t tile = mapCache_.at(mapIndex(index));
+    if (!tile->tryAcquireSemaphore()) {
+      this->unlockCache();
+      tile->waitSemaphore();
+      this->lockCache();
+      return nullptr;
+    }
 
     // Update the tile position in the LRU
     lru_.erase(mapLRU_[tile]);
@@ -192,48 +415,92 @@ class Cache {
 
   /// @brief Get a new tile
   /// @param index Tile's index
+  /// @param partition Partition homing the tile
+  /// @param mostRecentlyUsed True to insert the tile as the most recently used, else as the least [default true]
   /// @return The new tile
-  [[nodiscard]] CachedTile_t newLockedTile(std::vector<size_t> const &index) {
+  [[nodiscard]] CachedTile_t newLockedTile(std::vector<size_t> const &index, size_t partition,
+                                           bool mostRecentlyUsed = true) {
     // Get tile from the pool
-    CachedTile_t tile = pool_.front();    
+    CachedTile_t tile = pools_.at(partition).front();
     tile->acquireSemaphore();
 
-    pool_.pop();
+    pools_.at(partition).pop();
 
     // Set tile information except data
     tile->index(index);
 
     // Register the tile
     mapCache_.at(mapIndex(index)) = tile;
-    lru_.push_front(tile);
-    mapLRU_[tile] = lru_.begin();
+    if (mostRecentlyUsed) {
+      lru_.push_front(tile);
+      mapLRU_[tile] = lru_.begin();
+    } else {
+      lru_.push_back(tile);
+      mapLRU_[tile] = std::prev(lru_.end());
+    }
     return tile;
   }
 
-  /// @brief Recycle the tile
-  void recycleTile() {
+  /// @brief Recycle a tile of a partition to load a missed tile, and decide the missed tile admission
+  /// @details The least recently used tile of the partition not pinned, not aliased and not in use is recycled. The
+  /// admission is decided against it before it is evicted. A tile not admitted only takes the slot of a tile less
+  /// recently used than the tiles in use, so concurrent scans do not evict the hot tiles. If no tile can be recycled,
+  /// the cache is unlocked while waiting for a tile to be released, and nothing is recycled so the cache needs to be
+  /// looked up again.
+  /// @param partition Partition of the tile to recycle
+  /// @param flatIndex Flattened index of the missed tile
+  /// @param admitted Admission of the missed tile, set to false if the TinyLFU admission declines it
+  /// @return True if a tile has been recycled, else false
+  bool recycleTile(size_t partition, size_t flatIndex, bool &admitted) {
     CachedTile_t toRecycle;
+    bool lessRecentlyUsedInUse = false;
 
     auto begin = std::chrono::system_clock::now();
+    // Read before looking for a tile, so a tile released during the search wakes up the wait
+    size_t const nbReleases = *nbReleases_;
+
+    // Get the LRU Tile of the partition not pinned, not aliased and not in use
+    for (auto tile = lru_.crbegin(); tile != lru_.crend() && !toRecycle; ++tile) {
+      if ((*tile)->partition() != partition || pinned_.at(mapIndex((*tile)->index()))) { continue; }
+      if ((*tile)->tryAcquireRecyclable()) { toRecycle = *tile; }
+      else if (!(*tile)->aliased()) { lessRecentlyUsedInUse = true; }
+    }
+    if (toRecycle) {
+      if (admitted && frequencySketch_) {
+        admitted = frequencySketch_->estimate(flatIndex) > frequencySketch_->estimate(mapIndex(toRecycle->index()));
+      }
+      if (!admitted && lessRecentlyUsedInUse) {
+        toRecycle->releaseRecyclable();
+        toRecycle = nullptr;
+      }
+    }
+    // If no tile can be recycled, wait for a tile to be released
+    if (!toRecycle) {
+      this->unlockCache();
+      nbReleases_->wait(nbReleases);
+      this->lockCache();
+      recycleTime_ += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now() - begin);
+      return false;
+    }
 
-    // Get LRU Tile
-    toRecycle = lru_.back();
-    toRecycle->acquireSemaphore();
-    
-    lru_.pop_back();
+    lru_.erase(mapLRU_.at(toRecycle));
+    size_t const evictedIndex = mapIndex(toRecycle->index());
 
     // Clean The Tile
     mapLRU_.erase(toRecycle);
-    mapCache_.at(mapIndex(toRecycle->index())) = nullptr;
+    mapCache_.at(evictedIndex) = nullptr;
+    // The data are compressed to the second tier by the thread loading the new tile, outside of the cache lock
+    if (compressedCache_ && !toRecycle->newTile()) { toRecycle->evicted(evictedIndex); }
     toRecycle->newTile(true);
 
     // Put it back in the pool
-    pool_.push(toRecycle);
+    pools_.at(partition).push(toRecycle);
 
     auto end = std::chrono::system_clock::now();
     recycleTime_ += std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
     
     toRecycle->releaseSemaphore();
+    return true;
   }
 
 };
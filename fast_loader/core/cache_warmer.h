@@ -0,0 +1,152 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_CACHE_WARMER_H
+#define FAST_LOADER_CACHE_WARMER_H
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "cache.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Cache snapshot: the tiles resident in the caches, per level, in LRU order (most recently used first)
+using CacheSnapshot = std::vector<std::vector<std::vector<size_t>>>;
+
+/// @brief Preload in the background the tiles of a cache snapshot, to regain the hit rate of a previous run
+/// @details The tiles are loaded by a dedicated thread, with its own copy of the tile loader, most recently used tiles
+/// first. The preloading has a lower priority than the live requests:
+/// - it waits while the tile loader is loading tiles for live requests,
+/// - it only fills the free cache slots, it never evicts a tile nor waits for a tile in use,
+/// - it stops once the caches are full.
+/// @tparam DataType Type of the tile elements
+template<class DataType>
+class CacheWarmer {
+ private:
+  std::atomic<bool> stop_{false}; ///< Stop flag
+  std::atomic<size_t> nbPreloadedTiles_{0}; ///< Number of tiles preloaded
+  std::atomic<bool> done_{false}; ///< Flag set when the preloading is over
+  std::thread thread_{}; ///< Preloading thread
+
+ public:
+  /// @brief Start preloading the tiles of a snapshot
+  /// @param snapshot Cache snapshot, the tiles of unknown levels or with invalid indices are ignored
+  /// @param caches Caches per level
+  /// @param loadTile Function filling a new cached tile from its index and level
+  /// @param liveLoading Function returning true while tiles are loaded for live requests
+  CacheWarmer(CacheSnapshot snapshot,
+              std::shared_ptr<std::vector<std::shared_ptr<Cache<DataType>>>> caches,
+              std::function<void(std::shared_ptr<CachedTile<DataType>> const &, std::vector<size_t> const &,
+                                 size_t)> loadTile,
+              std::function<bool()> liveLoading) {
+    thread_ = std::thread(
+        [this, snapshot = std::move(snapshot), caches = std::move(caches), loadTile = std::move(loadTile),
+            liveLoading = std::move(liveLoading)]() {
+          for (size_t level = 0; level < std::min(snapshot.size(), caches->size()) && !stop_; ++level) {
+            auto const &cache = caches->at(level);
+            for (auto const &index : snapshot.at(level)) {
+              while (liveLoading() && !stop_) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+              if (stop_ || !cache->hasFreeTile()) { break; }
+              if (!cache->isValidIndex(index)) { continue; }
+              if (auto tile = cache->preloadTile(index)) {
+                tile->lock();
+                tile->newTile(false);
+                if (!cache->restoreTile(tile)) {
+                  loadTile(tile, index, level);
+                  cache->saveTile(tile);
+                }
+                tile->unlock();
+                tile->releaseSemaphore();
+                ++nbPreloadedTiles_;
+              }
+            }
+          }
+          done_ = true;
+        });
+  }
+
+  /// @brief Stop the preloading and join the thread
+  virtual ~CacheWarmer() {
+    stop_ = true;
+    if (thread_.joinable()) { thread_.join(); }
+  }
+
+  /// @brief Number of tiles preloaded accessor
+  /// @return Number of tiles preloaded so far
+  [[nodiscard]] size_t nbPreloadedTiles() const { return nbPreloadedTiles_; }
+
+  /// @brief Preloading over flag accessor
+  /// @return True if the preloading is over
+  [[nodiscard]] bool done() const { return done_; }
+
+  /// @brief Write the tiles resident in caches to a snapshot file
+  /// @details One line per tile: the level followed by the tile index, per level in LRU order
+  /// @param path Snapshot file path
+  /// @param caches Caches per level
+  /// @throw std::runtime_error If the file can not be written
+  static void save(std::filesystem::path const &path,
+                   std::vector<std::shared_ptr<Cache<DataType>>> const &caches) {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) { throw std::runtime_error("The cache snapshot " + path.string() + " can not be written."); }
+    file << "# FastLoader cache snapshot\n";
+    for (size_t level = 0; level < caches.size(); ++level) {
+      for (auto const &index : caches.at(level)->residentIndices()) {
+        file << level;
+        for (auto const &position : index) { file << " " << position; }
+        file << "\n";
+      }
+    }
+    if (!file) { throw std::runtime_error("The cache snapshot " + path.string() + " can not be written."); }
+  }
+
+  /// @brief Read a snapshot file
+  /// @param path Snapshot file path
+  /// @return Cache snapshot, empty if the file does not exist
+  static CacheSnapshot load(std::filesystem::path const &path) {
+    CacheSnapshot snapshot;
+    std::ifstream file(path);
+    std::string line;
+    while (file && std::getline(file, line)) {
+      if (line.empty() || line.front() == '#') { continue; }
+      std::istringstream iss(line);
+      size_t level, position;
+      std::vector<size_t> index;
+      if (!(iss >> level)) { continue; }
+      while (iss >> position) { index.push_back(position); }
+      if (snapshot.size() <= level) { snapshot.resize(level + 1); }
+      snapshot.at(level).push_back(std::move(index));
+    }
+    return snapshot;
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_CACHE_WARMER_H
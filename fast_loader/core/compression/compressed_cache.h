@@ -0,0 +1,144 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_COMPRESSED_CACHE_H
+#define FAST_LOADER_COMPRESSED_CACHE_H
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "tile_codec.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Second tier of a tile cache, holding the tiles evicted from the first tier compressed with the TileCodec
+/// @details The tiers are exclusive: a tile restored into the first tier is removed from the compressed cache, and is
+/// compressed again when evicted. The least recently stored tiles are dropped when the capacity is exceeded.
+/// @tparam DataType Type of the tile elements
+template<class DataType>
+class CompressedCache {
+ private:
+  using Block = std::shared_ptr<std::vector<uint8_t> const>; ///< Compressed tile
+  size_t const capacityBytes_ = 0; ///< Maximum number of compressed bytes held
+  size_t nbBytes_ = 0; ///< Number of compressed bytes held
+  std::list<size_t> lru_{}; ///< Tiles order, most recently stored first
+  std::unordered_map<size_t, std::pair<Block, std::list<size_t>::iterator>> blocks_{}; ///< Tiles per flattened index
+  mutable std::mutex mutex_{}; ///< Compressed cache mutex, also taken to read the statistics
+  size_t
+      hit_ = 0, ///< Number of tiles restored from the compressed cache
+      miss_ = 0, ///< Number of tiles not found in the compressed cache
+      nbBytesUncompressed_ = 0, ///< Number of bytes given to the compressed cache, for the compression ratio
+      nbBytesCompressed_ = 0; ///< Number of bytes after compression, for the compression ratio
+
+ public:
+  /// @brief Compressed cache constructor
+  /// @param capacityBytes Maximum number of compressed bytes held
+  explicit CompressedCache(size_t capacityBytes) : capacityBytes_(capacityBytes) {}
+
+  /// @brief Number of tiles restored from the compressed cache accessor
+  /// @return Number of tiles restored from the compressed cache
+  [[nodiscard]] size_t hit() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hit_;
+  }
+  /// @brief Number of tiles not found in the compressed cache accessor
+  /// @return Number of tiles not found in the compressed cache
+  [[nodiscard]] size_t miss() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return miss_;
+  }
+  /// @brief Number of compressed bytes held accessor
+  /// @return Number of compressed bytes held
+  [[nodiscard]] size_t nbBytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return nbBytes_;
+  }
+  /// @brief Number of tiles held accessor
+  /// @return Number of tiles held
+  [[nodiscard]] size_t nbTiles() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return blocks_.size();
+  }
+  /// @brief Average compression ratio of the tiles stored so far
+  /// @return Uncompressed size divided by compressed size, 1 if no tile has been stored
+  [[nodiscard]] double compressionRatio() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return nbBytesCompressed_ ? (double) nbBytesUncompressed_ / (double) nbBytesCompressed_ : 1.;
+  }
+
+  /// @brief Compress and store a tile, the compression is done outside the lock
+  /// @param index Flattened tile index
+  /// @param data Tile elements
+  /// @param nbElements Number of elements
+  void store(size_t index, DataType const *data, size_t nbElements) {
+    Block block = std::make_shared<std::vector<uint8_t> const>(TileCodec<DataType>::compress(data, nbElements));
+    std::lock_guard<std::mutex> lock(mutex_);
+    nbBytesUncompressed_ += nbElements * sizeof(DataType);
+    nbBytesCompressed_ += block->size();
+    if (block->size() > capacityBytes_) { return; }
+    erase(index);
+    lru_.push_front(index);
+    nbBytes_ += block->size();
+    blocks_.emplace(index, std::make_pair(std::move(block), lru_.begin()));
+    while (nbBytes_ > capacityBytes_) { erase(lru_.back()); }
+  }
+
+  /// @brief Restore a tile and remove it from the compressed cache, the decompression is done outside the lock
+  /// @param index Flattened tile index
+  /// @param data Tile elements to fill
+  /// @param nbElements Number of elements
+  /// @return True if the tile has been restored, else false
+  bool load(size_t index, DataType *data, size_t nbElements) {
+    Block block = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = blocks_.find(index);
+      if (it == blocks_.end()) {
+        ++miss_;
+        return false;
+      }
+      ++hit_;
+      block = it->second.first;
+      erase(index);
+    }
+    TileCodec<DataType>::decompress(*block, data, nbElements);
+    return true;
+  }
+
+ private:
+  /// @brief Remove a tile if held
+  /// @param index Flattened tile index
+  void erase(size_t index) {
+    auto it = blocks_.find(index);
+    if (it != blocks_.end()) {
+      nbBytes_ -= it->second.first->size();
+      lru_.erase(it->second.second);
+      blocks_.erase(it);
+    }
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_COMPRESSED_CACHE_H
@@ -0,0 +1,228 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_TILE_CODEC_H
+#define FAST_LOADER_TILE_CODEC_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Fast lossless codec used to store the tiles in the compressed cache
+/// @details The bytes of the elements are first shuffled, byte k of every element being stored in the k-th plane, so
+/// the slowly varying high order bytes and the zeros of sparse data form long runs. The shuffled bytes are then
+/// compressed with an LZ77 scheme close to LZ4: a sequence is a token (literal length on the high nibble, match length
+/// minus 4 on the low nibble, 15 meaning more length bytes follow), the literals, and the match offset on 2 bytes. The
+/// last sequence only holds literals. The first byte of a block tells if it is compressed or stored as shuffled bytes.
+/// @tparam DataType Type of the tile elements
+template<class DataType>
+class TileCodec {
+ private:
+  static size_t constexpr MinMatch = 4; ///< Minimum length of a match
+  static size_t constexpr MaxOffset = 65535; ///< Maximum distance of a match
+  static size_t constexpr HashLog = 12; ///< Log2 of the number of entries in the match finder hash table
+  static uint8_t constexpr Stored = 0; ///< Block stored as shuffled bytes
+  static uint8_t constexpr Compressed = 1; ///< Block compressed
+
+ public:
+  /// @brief Compress elements
+  /// @param data Elements to compress
+  /// @param nbElements Number of elements
+  /// @return Compressed block
+  static std::vector<uint8_t> compress(DataType const *data, size_t nbElements) {
+    std::vector<uint8_t> shuffled(nbElements * sizeof(DataType));
+    shuffle(reinterpret_cast<uint8_t const *>(data), shuffled.data(), nbElements);
+
+    std::vector<uint8_t> block;
+    block.reserve(shuffled.size() / 2 + 16);
+    block.push_back(Compressed);
+    if (!compressBytes(shuffled, block)) {
+      block.assign(1, Stored);
+      block.insert(block.end(), shuffled.cbegin(), shuffled.cend());
+    }
+    block.shrink_to_fit();
+    return block;
+  }
+
+  /// @brief Decompress a block into elements
+  /// @param block Compressed block
+  /// @param data Elements to fill
+  /// @param nbElements Number of elements
+  /// @throw std::runtime_error If the block is corrupted or does not match the number of elements
+  static void decompress(std::vector<uint8_t> const &block, DataType *data, size_t nbElements) {
+    size_t const nbBytes = nbElements * sizeof(DataType);
+    if (block.empty()) { throw std::runtime_error("The compressed tile is empty."); }
+    std::vector<uint8_t> shuffled;
+    if (block.front() == Stored) {
+      if (block.size() != nbBytes + 1) { throw std::runtime_error("The stored tile does not have the right size."); }
+      shuffled.assign(block.cbegin() + 1, block.cend());
+    } else {
+      shuffled.resize(nbBytes);
+      decompressBytes(block, shuffled);
+    }
+    unshuffle(shuffled.data(), reinterpret_cast<uint8_t *>(data), nbElements);
+  }
+
+ private:
+  /// @brief Gather the byte k of every element in the plane k
+  /// @param from Elements bytes
+  /// @param to Shuffled bytes
+  /// @param nbElements Number of elements
+  static void shuffle(uint8_t const *from, uint8_t *to, size_t nbElements) {
+    for (size_t element = 0; element < nbElements; ++element) {
+      for (size_t byte = 0; byte < sizeof(DataType); ++byte) {
+        to[byte * nbElements + element] = from[element * sizeof(DataType) + byte];
+      }
+    }
+  }
+
+  /// @brief Scatter back the planes into the elements
+  /// @param from Shuffled bytes
+  /// @param to Elements bytes
+  /// @param nbElements Number of elements
+  static void unshuffle(uint8_t const *from, uint8_t *to, size_t nbElements) {
+    for (size_t byte = 0; byte < sizeof(DataType); ++byte) {
+      for (size_t element = 0; element < nbElements; ++element) {
+        to[element * sizeof(DataType) + byte] = from[byte * nbElements + element];
+      }
+    }
+  }
+
+  /// @brief Read 4 bytes
+  /// @param src Position to read from
+  /// @return Value read
+  static uint32_t read32(uint8_t const *src) {
+    uint32_t value;
+    std::memcpy(&value, src, sizeof(value));
+    return value;
+  }
+
+  /// @brief Write a length exceeding its nibble, as a series of 255 and a remainder
+  /// @param length Length minus 15
+  /// @param block Block to write into
+  static void writeLength(size_t length, std::vector<uint8_t> &block) {
+    for (; length >= 255; length -= 255) { block.push_back(255); }
+    block.push_back((uint8_t) length);
+  }
+
+  /// @brief Write a sequence of literals optionally followed by a match
+  /// @param literals First literal
+  /// @param nbLiterals Number of literals
+  /// @param offset Match distance, unused if matchLength is 0
+  /// @param matchLength Match length, 0 for the last sequence
+  /// @param block Block to write into
+  static void writeSequence(uint8_t const *literals, size_t nbLiterals, size_t offset, size_t matchLength,
+                            std::vector<uint8_t> &block) {
+    size_t const matchCode = matchLength ? matchLength - MinMatch : 0;
+    block.push_back((uint8_t) ((std::min(nbLiterals, (size_t) 15) << 4) | std::min(matchCode, (size_t) 15)));
+    if (nbLiterals >= 15) { writeLength(nbLiterals - 15, block); }
+    block.insert(block.end(), literals, literals + nbLiterals);
+    if (matchLength) {
+      block.push_back((uint8_t) (offset & 0xFF));
+      block.push_back((uint8_t) (offset >> 8));
+      if (matchCode >= 15) { writeLength(matchCode - 15, block); }
+    }
+  }
+
+  /// @brief Compress bytes with the LZ scheme
+  /// @param src Bytes to compress
+  /// @param block Block to write into
+  /// @return True if the compressed bytes are smaller than the source, else false
+  static bool compressBytes(std::vector<uint8_t> const &src, std::vector<uint8_t> &block) {
+    size_t const size = src.size();
+    uint8_t const *bytes = src.data();
+    std::vector<size_t> table(1 << HashLog, 0); // Position + 1 of the last occurrence of a hash, 0 for none
+    size_t position = 0, anchor = 0, nbMisses = 0;
+
+    while (position + MinMatch <= size) {
+      uint32_t const sequence = read32(bytes + position);
+      size_t const hash = (sequence * 2654435761U) >> (32 - HashLog);
+      size_t const candidate = table.at(hash);
+      table.at(hash) = position + 1;
+      if (candidate && position - (candidate - 1) <= MaxOffset && read32(bytes + candidate - 1) == sequence) {
+        size_t const match = candidate - 1;
+        size_t length = MinMatch;
+        while (position + length < size && bytes[match + length] == bytes[position + length]) { ++length; }
+        writeSequence(bytes + anchor, position - anchor, position - match, length, block);
+        position += length;
+        anchor = position;
+        nbMisses = 0;
+      } else {
+        // Skip faster through incompressible data
+        position += 1 + (nbMisses++ >> 6);
+      }
+      if (block.size() >= size) { return false; }
+    }
+    writeSequence(bytes + anchor, size - anchor, 0, 0, block);
+    return block.size() < size + 1;
+  }
+
+  /// @brief Decompress bytes compressed with the LZ scheme
+  /// @param block Compressed block, including its first byte
+  /// @param dst Bytes to fill, already sized
+  /// @throw std::runtime_error If the block is corrupted
+  static void decompressBytes(std::vector<uint8_t> const &block, std::vector<uint8_t> &dst) {
+    size_t in = 1, out = 0;
+    auto readLength = [&block, &in](size_t length) {
+      if (length == 15) {
+        uint8_t extra;
+        do {
+          if (in >= block.size()) { throw std::runtime_error("The compressed tile is corrupted."); }
+          extra = block[in++];
+          length += extra;
+        } while (extra == 255);
+      }
+      return length;
+    };
+
+    while (true) {
+      if (in >= block.size()) { throw std::runtime_error("The compressed tile is corrupted."); }
+      uint8_t const token = block[in++];
+      size_t const nbLiterals = readLength(token >> 4);
+      if (in + nbLiterals > block.size() || out + nbLiterals > dst.size()) {
+        throw std::runtime_error("The compressed tile is corrupted.");
+      }
+      std::memcpy(dst.data() + out, block.data() + in, nbLiterals);
+      in += nbLiterals;
+      out += nbLiterals;
+      if (out == dst.size()) { break; }
+
+      if (in + 2 > block.size()) { throw std::runtime_error("The compressed tile is corrupted."); }
+      size_t const offset = block[in] | ((size_t) block[in + 1] << 8);
+      in += 2;
+      size_t const length = readLength(token & 0x0F) + MinMatch;
+      if (offset == 0 || offset > out || out + length > dst.size()) {
+        throw std::runtime_error("The compressed tile is corrupted.");
+      }
+      // Byte per byte, the match can overlap the bytes being written
+      for (size_t byte = 0; byte < length; ++byte, ++out) { dst[out] = dst[out - offset]; }
+    }
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_TILE_CODEC_H
@@ -19,6 +19,7 @@
 #ifndef FAST_LOADER_ADAPTIVE_TILE_REQUEST_H
 #define FAST_LOADER_ADAPTIVE_TILE_REQUEST_H
 
+#include <atomic>
 #include "cached_tile.h"
 #include "tile_request.h"
 #include "view/adaptive_view.h"
@@ -36,9 +37,9 @@ template<class ViewType>
 class AdaptiveTileRequest : public TileRequest<ViewType> {
  private:
   using DataType = typename ViewType::data_t; ///< Sample type (AbstractView element type)
-  size_t
-      nbPhysicalTileRequests_ = 0, ///< Number of physical Tile request made to fill a logical cached tile
-  id_ = 0; ///< Unique Id
+  std::shared_ptr<std::atomic<size_t>>
+      remainingPhysicalTileRequests_{}; ///< Number of physical tile requests left to fill the logical cached tile,
+  ///< shared between all the pieces of a logical tile
 
   std::shared_ptr<TileRequest<ViewType>> const
       logicalTileRequest_{}; ///< Original Tile Request, used after in the view counter to build the final view
@@ -54,11 +55,13 @@ class AdaptiveTileRequest : public TileRequest<ViewType> {
   /// @brief Constructor used if logical tile is already cached
   /// @param logicalTileRequest Original logical tile request
   /// @param logicalCachedTile Logical cached tile already filled
+  /// @param pool Pool the copies are allocated from, nullptr to allocate them from the heap [default nullptr]
   AdaptiveTileRequest(
       std::shared_ptr<TileRequest<ViewType>> const &logicalTileRequest,
-      std::shared_ptr<fl::internal::CachedTile<DataType>> const &logicalCachedTile) :
+      std::shared_ptr<fl::internal::CachedTile<DataType>> const &logicalCachedTile,
+      std::shared_ptr<TileRequestPool> const &pool = nullptr) :
   // Dummy values because not used
-      TileRequest<ViewType>(logicalTileRequest->index(), logicalTileRequest->view()),
+      TileRequest<ViewType>(logicalTileRequest->index(), logicalTileRequest->view(), pool),
       logicalTileRequest_(logicalTileRequest),
       logicalCachedTile_(logicalCachedTile),
       needCopyFromPhysicalTileLoader_(false) {}
@@ -68,11 +71,13 @@ class AdaptiveTileRequest : public TileRequest<ViewType> {
   /// @param adaptiveView Fake view, mimicking a requested view but with a logical cache as piece of data
   /// @param logicalTileRequest Original logical tile request
   /// @param logicalCachedTile Logical cached tile to fill
+  /// @param pool Pool the copies are allocated from, nullptr to allocate them from the heap [default nullptr]
   AdaptiveTileRequest(std::vector<size_t> const index,
                       std::shared_ptr<fl::internal::AdaptiveView<ViewType>> adaptiveView,
                       std::shared_ptr<TileRequest<ViewType>> const &logicalTileRequest,
-                      std::shared_ptr<fl::internal::CachedTile<DataType>> const &logicalCachedTile) :
-      TileRequest<ViewType>(index, std::static_pointer_cast<ViewType>(adaptiveView)),
+                      std::shared_ptr<fl::internal::CachedTile<DataType>> const &logicalCachedTile,
+                      std::shared_ptr<TileRequestPool> const &pool = nullptr) :
+      TileRequest<ViewType>(index, std::static_pointer_cast<ViewType>(adaptiveView), pool),
       logicalTileRequest_(logicalTileRequest),
       logicalCachedTile_(logicalCachedTile),
       adaptiveView_(adaptiveView),
@@ -93,23 +98,17 @@ class AdaptiveTileRequest : public TileRequest<ViewType> {
   /// @return The logical cached tile
   std::shared_ptr<fl::internal::CachedTile<DataType>> logicalCachedTile() const { return logicalCachedTile_; }
 
-  /// @brief Accessor to the number of physical tile requests
-  /// @return The number of physical tile requests
-  [[nodiscard]] size_t nbPhysicalTileRequests() const { return nbPhysicalTileRequests_; }
-
-  /// @brief Accessor to the logical tile id
-  /// @return Logical tile id
-  [[nodiscard]] size_t id() const { return id_; }
-
-  /// @brief Setter to the number of physical tile requests
-  /// @param nbPhysicalTileRequests Number of physical tile requests to set
-  void nbPhysicalTileRequests(size_t nbPhysicalTileRequests) {
-    this->nbPhysicalTileRequests_ = nbPhysicalTileRequests;
+  /// @brief Setter to the countdown of physical tile requests shared between all the pieces of a logical tile
+  /// @param remainingPhysicalTileRequests Countdown initialized with the number of physical tile requests
+  void remainingPhysicalTileRequests(std::shared_ptr<std::atomic<size_t>> const &remainingPhysicalTileRequests) {
+    remainingPhysicalTileRequests_ = remainingPhysicalTileRequests;
   }
 
-  /// @brief Setter to the logical tile id
-  /// @param id Logical tile id
-  void id(size_t id) { id_ = id; }
+  /// @brief Signal that the physical tile request has been copied into the logical cached tile
+  /// @return True if it was the last piece filling the logical cached tile, else false
+  bool physicalTileRequestDone() {
+    return remainingPhysicalTileRequests_->fetch_sub(1, std::memory_order_acq_rel) == 1;
+  }
 
 };
 
@@ -0,0 +1,130 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_BATCH_BUFFER_H
+#define FAST_LOADER_BATCH_BUFFER_H
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <stdexcept>
+#include "../buffer_allocator/buffer_allocation.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Contiguous buffer holding a batch of views, each view being a slot of viewSize elements
+/// @details The slots are handed out by the BatchAllocator in request order. A batch is sealed when all the slots have
+/// been handed out, or earlier on timeout / at the end of the stream, and can be reused once all its slots have been
+/// released.
+/// @tparam DataType Type of data inside the View
+template<class DataType>
+class BatchBuffer {
+ private:
+  DataType *data_ = nullptr; ///< Batch data, [capacity, viewSize]
+  size_t const
+      viewSize_ = 0, ///< Number of elements in a slot
+      capacity_ = 0, ///< Number of slots
+      level_ = 0; ///< Pyramidal level of the views in the batch
+  size_t nbSlotsAssigned_ = 0; ///< Number of slots handed out, protected by the BatchAllocator
+  bool sealed_ = false; ///< Sealed flag, no more slots are handed out once sealed, protected by the BatchAllocator
+  std::atomic<size_t> nbSlotsInUse_{0}; ///< Number of slots in use by a view
+  std::chrono::steady_clock::time_point openingTime_{}; ///< Time when the batch has been opened
+  std::shared_ptr<AbstractBufferAllocator> const
+      bufferAllocator_ = nullptr; ///< Allocator of the batch buffer, nullptr to use new[]
+
+ public:
+  /// @brief BatchBuffer constructor
+  /// @param viewSize Number of elements in a slot
+  /// @param capacity Number of slots
+  /// @param level Pyramidal level of the views in the batch
+  /// @param bufferAllocator Allocator of the batch buffer, nullptr to use new[] [default nullptr]
+  /// @throw std::runtime_error If the buffer can not be allocated
+  BatchBuffer(size_t viewSize, size_t capacity, size_t level,
+              std::shared_ptr<AbstractBufferAllocator> bufferAllocator = nullptr)
+      : viewSize_(viewSize), capacity_(capacity), level_(level), bufferAllocator_(std::move(bufferAllocator)) {
+    try {
+      data_ = allocateBuffer<DataType>(bufferAllocator_, viewSize_ * capacity_);
+    } catch (std::bad_alloc const &except) {
+      std::ostringstream oss;
+      oss << "Problem while allocating a batch of " << capacity_ << " views of " << viewSize_ << " elements: "
+          << except.what();
+      throw std::runtime_error(oss.str());
+    }
+    openingTime_ = std::chrono::steady_clock::now();
+  }
+
+  /// @brief BatchBuffer destructor, clean the raw array
+  ~BatchBuffer() { deallocateBuffer(bufferAllocator_, data_, viewSize_ * capacity_); }
+
+  /// @brief Batch data accessor
+  /// @return Batch data
+  [[nodiscard]] DataType *data() const { return data_; }
+  /// @brief Slot size accessor
+  /// @return Number of elements in a slot
+  [[nodiscard]] size_t viewSize() const { return viewSize_; }
+  /// @brief Capacity accessor
+  /// @return Number of slots
+  [[nodiscard]] size_t capacity() const { return capacity_; }
+  /// @brief Level accessor
+  /// @return Pyramidal level of the views in the batch
+  [[nodiscard]] size_t level() const { return level_; }
+  /// @brief Number of slots handed out accessor
+  /// @return Number of slots handed out
+  [[nodiscard]] size_t nbSlotsAssigned() const { return nbSlotsAssigned_; }
+  /// @brief Sealed flag accessor
+  /// @return True if the batch is sealed
+  [[nodiscard]] bool sealed() const { return sealed_; }
+  /// @brief Opening time accessor
+  /// @return Time when the batch has been opened
+  [[nodiscard]] std::chrono::steady_clock::time_point const &openingTime() const { return openingTime_; }
+
+  /// @brief Test if the batch can be reused
+  /// @return True if the batch is sealed and all its slots have been released
+  [[nodiscard]] bool reusable() const { return sealed_ && nbSlotsInUse_ == 0; }
+
+  /// @brief Reopen a reusable batch
+  void reopen() {
+    nbSlotsAssigned_ = 0;
+    sealed_ = false;
+    openingTime_ = std::chrono::steady_clock::now();
+  }
+
+  /// @brief Hand out the next slot, the batch is sealed when full
+  /// @return Index of the slot handed out
+  size_t assignSlot() {
+    ++nbSlotsInUse_;
+    size_t slot = nbSlotsAssigned_++;
+    if (nbSlotsAssigned_ == capacity_) { sealed_ = true; }
+    return slot;
+  }
+
+  /// @brief Seal the batch, no more slot will be handed out
+  void seal() { sealed_ = true; }
+
+  /// @brief Release a slot, called when a view is recycled
+  void releaseSlot() { --nbSlotsInUse_; }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_BATCH_BUFFER_H
@@ -27,6 +27,8 @@
 #include <iterator>
 #include <ostream>
 #include <semaphore>
+#include <atomic>
+#include "../../api/data/tile_buffer.h"
 
 /// @brief FastLoader namespace
 namespace fl {
@@ -39,20 +41,31 @@ namespace internal {
 template<class DataType>
 class CachedTile {
  protected:
-  std::shared_ptr<std::vector<DataType>> data_{}; ///< Tile data.
+  std::shared_ptr<TileBuffer<DataType>> data_{}; ///< Tile data.
   std::vector<size_t> index_{}; ///< Tile index
   std::vector<size_t> const dimension_{}; ///< Tile dimensions
   bool newTile_{}; ///< Flax for new tile
+  size_t partition_ = 0; ///< Cache partition (NUMA node) homing the tile
+  bool holdsEvictedData_ = false; ///< Flag set if the data of an evicted tile are still in the buffer
+  size_t evictedIndex_ = 0; ///< Flattened index of the evicted tile whose data are still in the buffer
+  bool paddingFilled_ = false; ///< Flag set once the padding of the tile has been filled for its aliases
   std::mutex accessMutex_{}; ///< Mutex for accessing the tile
   std::binary_semaphore semaphore_{1}; ///< Semaphore for cache safety
+  std::atomic<size_t> nbAliases_{0}; ///< Number of views aliasing the tile, an aliased tile is not recycled
+  std::shared_ptr<std::atomic<size_t>>
+      nbReleases_ = nullptr; ///< Counter of the cache tiles releases, notified when the tile is released or unaliased
 
  public:
   /// @brief Cached tile constructor
   /// @param dimension  Dimension of the cached tile
-  explicit CachedTile(std::vector<size_t> dimension) : dimension_(std::move(dimension)), newTile_(true) {
+  /// @param bufferAllocator Buffer allocator of the tile buffer, nullptr for the default allocation [default nullptr]
+  explicit CachedTile(std::vector<size_t> dimension,
+                      std::shared_ptr<AbstractBufferAllocator> const &bufferAllocator = nullptr)
+      : dimension_(std::move(dimension)), newTile_(true) {
     try {
-      data_ = std::make_shared<std::vector<DataType>>(
-          std::accumulate(dimension_.begin(), dimension_.end(), (size_t) 1, std::multiplies<>())
+      data_ = std::make_shared<TileBuffer<DataType>>(
+          std::accumulate(dimension_.begin(), dimension_.end(), (size_t) 1, std::multiplies<>()),
+          TileBufferAllocator<DataType>(bufferAllocator)
       );
     } catch (std::bad_alloc const &except) {
       std::ostringstream oss;
@@ -68,7 +81,7 @@ class CachedTile {
 
   /// @brief Data accessor
   /// @return Data
-  std::shared_ptr<std::vector<DataType>> const &data() const { return data_; }
+  std::shared_ptr<TileBuffer<DataType>> const &data() const { return data_; }
   /// @brief Cached tile index accessor
   /// @return Cached tile index
   [[nodiscard]] std::vector<size_t> const &index() const { return index_; }
@@ -78,13 +91,45 @@ class CachedTile {
   /// @brief New tile flag accessor
   /// @return New tile flag
   [[nodiscard]] bool newTile() const { return newTile_; }
+  /// @brief Cache partition accessor
+  /// @return Cache partition (NUMA node) homing the tile
+  [[nodiscard]] size_t partition() const { return partition_; }
+  /// @brief Evicted data flag accessor
+  /// @return True if the data of an evicted tile are still in the buffer
+  [[nodiscard]] bool holdsEvictedData() const { return holdsEvictedData_; }
+  /// @brief Evicted tile index accessor
+  /// @return Flattened index of the evicted tile whose data are still in the buffer
+  [[nodiscard]] size_t evictedIndex() const { return evictedIndex_; }
+  /// @brief Padding filled flag accessor
+  /// @return True if the padding of the tile has been filled for its aliases since the tile has been loaded
+  [[nodiscard]] bool paddingFilled() const { return paddingFilled_; }
 
   /// @brief Cached tile index setter
   /// @param index Cache tile index to set
   void index(std::vector<size_t> const &index) { index_ = index; }
   /// @brief New tile flag setter
-  /// @param newTile New tile flag to set
-  void newTile(bool newTile) { newTile_ = newTile; }
+  /// @param newTile New tile flag to set, a new tile has its padding to fill again
+  void newTile(bool newTile) {
+    newTile_ = newTile;
+    if (newTile_) { paddingFilled_ = false; }
+  }
+  /// @brief Padding filled flag setter
+  /// @param paddingFilled True once the padding of the tile has been filled for its aliases
+  void paddingFilled(bool paddingFilled) { paddingFilled_ = paddingFilled; }
+  /// @brief Cache partition setter
+  /// @param partition Cache partition (NUMA node) homing the tile
+  void partition(size_t partition) { partition_ = partition; }
+  /// @brief Flag the data in the buffer as belonging to an evicted tile
+  /// @param evictedIndex Flattened index of the evicted tile
+  void evicted(size_t evictedIndex) {
+    holdsEvictedData_ = true;
+    evictedIndex_ = evictedIndex;
+  }
+  /// @brief Clear the evicted data flag, once the data have been saved or overwritten
+  void clearEvicted() { holdsEvictedData_ = false; }
+  /// @brief Releases counter setter
+  /// @param nbReleases Counter of the cache tiles releases, incremented and notified each time the tile is released
+  void releasesCounter(std::shared_ptr<std::atomic<size_t>> nbReleases) { nbReleases_ = std::move(nbReleases); }
 
   /// @brief Lock inner mutex
   void lock() { accessMutex_.lock(); }
@@ -98,7 +143,47 @@ class CachedTile {
 
   void releaseSemaphore() {
     semaphore_.release();
-  } 
+    notifyRelease();
+  }
+
+  /// @brief Try to acquire the semaphore without blocking
+  /// @return True if the semaphore has been acquired, else false (the tile is in use)
+  bool tryAcquireSemaphore() { return semaphore_.try_acquire(); }
+
+  /// @brief Wait for the semaphore to be available, without keeping it
+  void waitSemaphore() {
+    semaphore_.acquire();
+    semaphore_.release();
+  }
+
+  /// @brief Try to acquire the semaphore of a tile to recycle without blocking
+  /// @return True if the semaphore has been acquired and the tile is not aliased, else false
+  bool tryAcquireRecyclable() {
+    if (nbAliases_ > 0 || !semaphore_.try_acquire()) { return false; }
+    // The tile may have been aliased by the previous semaphore holder
+    if (nbAliases_ > 0) {
+      semaphore_.release();
+      return false;
+    }
+    return true;
+  }
+
+  /// @brief Release the semaphore acquired with tryAcquireRecyclable if the tile is not recycled, the tile state did
+  /// not change so the waiting threads are not notified
+  void releaseRecyclable() { semaphore_.release(); }
+
+  /// @brief Add a read pin for a view aliasing the tile, to call while holding the semaphore
+  void pinAlias() { ++nbAliases_; }
+
+  /// @brief Remove a read pin, the tile can be recycled once no view aliases it
+  void unpinAlias() {
+    --nbAliases_;
+    notifyRelease();
+  }
+
+  /// @brief Aliased flag accessor
+  /// @return True if at least a view aliases the tile
+  [[nodiscard]] bool aliased() const { return nbAliases_ > 0; }
 
   /// @brief Output stream operator for the cached tile
   /// @param os Output stream
@@ -115,6 +200,15 @@ class CachedTile {
     return os;
   }
 
+ private:
+  /// @brief Notify the threads waiting for a tile to recycle that the tile has been released
+  void notifyRelease() {
+    if (nbReleases_) {
+      ++(*nbReleases_);
+      nbReleases_->notify_all();
+    }
+  }
+
 };
 
 } // fl
@@ -24,6 +24,7 @@
 #include <tuple>
 #include <ostream>
 #include <iterator>
+#include "small_vector.h"
 
 /// @brief FastLoader namespace
 namespace fl {
@@ -31,13 +32,14 @@ namespace fl {
 namespace internal {
 
 /// @brief Volume representation used to define copies
+/// @details The positions, dimension and flags are stored inline, a copy does not allocate from the heap
 class CopyVolume {
-  std::vector<size_t> const
+  SmallVector<size_t>
       positionFrom_, ///< Source position
       positionTo_, ///< Destination position
       dimension_; ///< Copy dimension
 
-  std::vector<bool> const reverseCopies_; ///< Flag used to determine if the copies should be made in reverse
+  SmallVector<bool> reverseCopies_; ///< Flag used to determine if the copies should be made in reverse
 
  public:
   /// @brief Copy Volume constructor
@@ -46,8 +48,8 @@ class CopyVolume {
   /// @param dimension Copy dimension
   /// @param reverseCopies Flag used to determine if the copies should be made in reverse
   CopyVolume(
-      std::vector<std::size_t> positionFrom, std::vector<std::size_t> positionTo,
-      std::vector<std::size_t> dimension, std::vector<bool> reverseCopies)
+      SmallVector<std::size_t> positionFrom, SmallVector<std::size_t> positionTo,
+      SmallVector<std::size_t> dimension, SmallVector<bool> reverseCopies)
       : positionFrom_(std::move(positionFrom)),
         positionTo_(std::move(positionTo)),
         dimension_(std::move(dimension)),
@@ -57,11 +59,12 @@ class CopyVolume {
   /// @param positionFrom Source position
   /// @param positionTo Destination position
   /// @param dimension Copy dimension
-  CopyVolume(std::vector<std::size_t> positionFrom, std::vector<std::size_t> positionTo, std::vector<std::size_t> dimension)
+  CopyVolume(SmallVector<std::size_t> positionFrom, SmallVector<std::size_t> positionTo,
+             SmallVector<std::size_t> dimension)
       : positionFrom_(std::move(positionFrom)),
         positionTo_(std::move(positionTo)),
         dimension_(std::move(dimension)),
-        reverseCopies_(std::vector<bool>(positionFrom_.size(), false)) {
+        reverseCopies_(SmallVector<bool>(positionFrom_.size(), false)) {
 
   }
 
@@ -70,16 +73,16 @@ class CopyVolume {
 
   /// @brief Source position accessor
   /// @return Source position
-  [[nodiscard]] std::vector<std::size_t> const &positionFrom() const { return positionFrom_; }
+  [[nodiscard]] SmallVector<std::size_t> const &positionFrom() const { return positionFrom_; }
   /// @brief Destination position accessor
   /// @return Destination position
-  [[nodiscard]] std::vector<std::size_t> const &positionTo() const { return positionTo_; }
+  [[nodiscard]] SmallVector<std::size_t> const &positionTo() const { return positionTo_; }
   /// @brief Copy dimension accessor
   /// @return Copy dimension
-  [[nodiscard]] std::vector<std::size_t> const &dimension() const { return dimension_; }
+  [[nodiscard]] SmallVector<std::size_t> const &dimension() const { return dimension_; }
   /// @brief Ordering flag accessor
   /// @return Ordering flag
-  [[nodiscard]] std::vector<bool> const &reverseCopies() const { return reverseCopies_; }
+  [[nodiscard]] SmallVector<bool> const &reverseCopies() const { return reverseCopies_; }
 
   /// @brief Equality operator
   /// @param rhs CopyVolume to compare against
@@ -0,0 +1,188 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+
+#ifndef FAST_LOADER_SMALL_VECTOR_H
+#define FAST_LOADER_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Fixed size vector storing its elements inline up to a capacity, on the heap past it
+/// @details Used for the coordinates of the tile requests and of their copies, with one element per dimension, so a
+/// request and its copies do not allocate from the heap for the usual number of dimensions.
+/// @tparam T Type of the elements
+/// @tparam Capacity Number of elements stored inline
+template<class T, size_t Capacity = 8>
+class SmallVector {
+ private:
+  std::array<T, Capacity> inline_{}; ///< Inline storage
+  std::unique_ptr<T[]> heap_ = nullptr; ///< Heap storage, only used past the capacity
+  size_t size_ = 0; ///< Number of elements
+
+ public:
+  /// @brief Default constructor, empty vector
+  SmallVector() = default;
+
+  /// @brief Constructor with a number of copies of a value
+  /// @param size Number of elements
+  /// @param value Value of the elements
+  SmallVector(size_t size, T const &value) {
+    allocate(size);
+    std::fill(begin(), end(), value);
+  }
+
+  /// @brief Constructor from a range
+  /// @tparam InputIt Type of the range iterators
+  /// @param first Begin of the range
+  /// @param last End of the range
+  template<std::forward_iterator InputIt>
+  SmallVector(InputIt first, InputIt last) {
+    allocate((size_t) std::distance(first, last));
+    std::copy(first, last, begin());
+  }
+
+  /// @brief Constructor from a list of values
+  /// @param values Values of the elements
+  SmallVector(std::initializer_list<T> values) : SmallVector(values.begin(), values.end()) {}
+
+  /// @brief Constructor from a std::vector
+  /// @param values Values of the elements
+  SmallVector(std::vector<T> const &values) : SmallVector(values.cbegin(), values.cend()) {}
+
+  /// @brief Copy constructor
+  /// @param rhs Vector to copy
+  SmallVector(SmallVector const &rhs) : SmallVector(rhs.cbegin(), rhs.cend()) {}
+
+  /// @brief Move constructor, the heap storage is moved
+  /// @param rhs Vector to move
+  SmallVector(SmallVector &&rhs) noexcept
+      : inline_(rhs.inline_), heap_(std::move(rhs.heap_)), size_(std::exchange(rhs.size_, 0)) {}
+
+  /// @brief Copy assignment
+  /// @param rhs Vector to copy
+  /// @return This vector
+  SmallVector &operator=(SmallVector const &rhs) {
+    if (this != &rhs) {
+      allocate(rhs.size_);
+      std::copy(rhs.cbegin(), rhs.cend(), begin());
+    }
+    return *this;
+  }
+
+  /// @brief Move assignment, the heap storage is moved
+  /// @param rhs Vector to move
+  /// @return This vector
+  SmallVector &operator=(SmallVector &&rhs) noexcept {
+    inline_ = rhs.inline_;
+    heap_ = std::move(rhs.heap_);
+    size_ = std::exchange(rhs.size_, 0);
+    return *this;
+  }
+
+  /// @brief Default destructor
+  ~SmallVector() = default;
+
+  /// @brief Number of elements accessor
+  /// @return Number of elements
+  [[nodiscard]] size_t size() const { return size_; }
+  /// @brief Emptiness accessor
+  /// @return True if the vector has no element
+  [[nodiscard]] bool empty() const { return size_ == 0; }
+
+  /// @brief Elements accessor
+  /// @return Pointer to the first element
+  [[nodiscard]] T *data() { return heap_ ? heap_.get() : inline_.data(); }
+  /// @brief Elements accessor
+  /// @return Pointer to the first element
+  [[nodiscard]] T const *data() const { return heap_ ? heap_.get() : inline_.data(); }
+
+  /// @brief Begin iterator accessor
+  /// @return Begin iterator
+  [[nodiscard]] T *begin() { return data(); }
+  /// @brief End iterator accessor
+  /// @return End iterator
+  [[nodiscard]] T *end() { return data() + size_; }
+  /// @brief Begin iterator accessor
+  /// @return Begin iterator
+  [[nodiscard]] T const *begin() const { return data(); }
+  /// @brief End iterator accessor
+  /// @return End iterator
+  [[nodiscard]] T const *end() const { return data() + size_; }
+  /// @brief Begin constant iterator accessor
+  /// @return Begin constant iterator
+  [[nodiscard]] T const *cbegin() const { return data(); }
+  /// @brief End constant iterator accessor
+  /// @return End constant iterator
+  [[nodiscard]] T const *cend() const { return data() + size_; }
+
+  /// @brief Element accessor with bounds checking
+  /// @param position Position of the element
+  /// @return Element at the position
+  /// @throw std::out_of_range If the position is out of the vector
+  [[nodiscard]] T &at(size_t position) {
+    if (position >= size_) { throw std::out_of_range("The position is out of the vector."); }
+    return data()[position];
+  }
+  /// @brief Element accessor with bounds checking
+  /// @param position Position of the element
+  /// @return Element at the position
+  /// @throw std::out_of_range If the position is out of the vector
+  [[nodiscard]] T const &at(size_t position) const {
+    if (position >= size_) { throw std::out_of_range("The position is out of the vector."); }
+    return data()[position];
+  }
+  /// @brief Element accessor
+  /// @param position Position of the element
+  /// @return Element at the position
+  [[nodiscard]] T &operator[](size_t position) { return data()[position]; }
+  /// @brief Element accessor
+  /// @param position Position of the element
+  /// @return Element at the position
+  [[nodiscard]] T const &operator[](size_t position) const { return data()[position]; }
+
+  /// @brief Equality operator
+  /// @param rhs Vector to compare against
+  /// @return True if the vectors have the same elements, else false
+  bool operator==(SmallVector const &rhs) const { return std::equal(cbegin(), cend(), rhs.cbegin(), rhs.cend()); }
+
+ private:
+  /// @brief Set the number of elements, on the heap if past the capacity, the elements are not initialized
+  /// @param size Number of elements
+  void allocate(size_t size) {
+    if (size > Capacity) { heap_ = std::make_unique<T[]>(size); }
+    else { heap_ = nullptr; }
+    size_ = size;
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_SMALL_VECTOR_H
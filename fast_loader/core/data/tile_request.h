@@ -27,6 +27,8 @@
 #include <ostream>
 
 #include "copy_volume.h"
+#include "small_vector.h"
+#include "../tile_request_pool.h"
 
 /// @brief FastLoader namespace
 namespace fl {
@@ -39,34 +41,40 @@ namespace internal {
 /// @tparam ViewType Type of the view
 template<class ViewType>
 class TileRequest {
-  std::vector<size_t> const index_; ///< Tile index
+  SmallVector<size_t> const index_; ///< Tile index, stored inline
   std::shared_ptr<ViewType> const view_{}; ///< AbstractView to copy into
-  std::list<CopyVolume> copies_{}; ///< List of copies to make from the request to the view
+  std::list<CopyVolume, PoolAllocator<CopyVolume>> copies_{}; ///< List of copies to make from the request to the view
 
  public:
   /// @brief TileRequest constructor
   /// @param index Tile index to build the view
   /// @param view View to fill
-  TileRequest(std::vector<size_t> const & index, std::shared_ptr<ViewType> const &view)
-      : index_(index), view_(view) {}
+  /// @param pool Pool the copies are allocated from, nullptr to allocate them from the heap [default nullptr]
+  TileRequest(SmallVector<size_t> const &index, std::shared_ptr<ViewType> const &view,
+              std::shared_ptr<TileRequestPool> const &pool = nullptr)
+      : index_(index), view_(view), copies_(PoolAllocator<CopyVolume>(pool)) {}
 
   /// @brief TileRequest destructor
   virtual ~TileRequest() = default;
 
   /// @brief Accessor to the index tiles used to fill the view
   /// @return Index tiles used to fill the view
-  [[nodiscard]] std::vector<size_t> const &index() const { return index_; }
+  [[nodiscard]] SmallVector<size_t> const &index() const { return index_; }
   /// @brief View accessor
   /// @return View to fill
   [[nodiscard]] std::shared_ptr<ViewType> const &view() const { return view_; }
   /// @brief Copies accessor
   /// @return Copies to do to fill the view
-  [[nodiscard]] std::list<CopyVolume> const &copies() const { return copies_; }
+  [[nodiscard]] std::list<CopyVolume, PoolAllocator<CopyVolume>> const &copies() const { return copies_; }
 
   /// @brief Add a copy to the list aof copies to make
   /// @param copy Copy to add
   void addCopy(CopyVolume const &copy) { copies_.push_back(copy); }
 
+  /// @brief Add a copy to the list aof copies to make, the copy is moved
+  /// @param copy Copy to add
+  void addCopy(CopyVolume &&copy) { copies_.push_back(std::move(copy)); }
+
   /// @brief Merge TileRequest
   /// @param rhs Tile request to merge into this instance
   /// @return This instance in which has been merged rhs
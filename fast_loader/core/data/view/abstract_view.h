@@ -85,6 +85,16 @@ class AbstractView {
     return globalPosition;
   }
 
+  /// @brief Region flag accessor
+  /// @return True if the view has been requested as an arbitrary region, else false
+  [[nodiscard]] bool isRegion() const { return this->viewData()->isRegion(); }
+  /// @brief Global position of the first element of a region accessor, only meaningful for regions
+  /// @return Global position of the first element of a region
+  [[nodiscard]] std::vector<std::size_t> const &regionOrigin() const { return this->viewData()->minPos(); }
+  /// @brief Preview flag accessor
+  /// @return True if the view is a preview upsampled from a coarser level, the full resolution view follows, else false
+  [[nodiscard]] bool isPreview() const { return this->viewData()->isPreview(); }
+
   /// @brief File / full dimensions accessor for a dimension
   /// @param dim Dimension index requested
   /// @return File / full dimensions for a dimension
@@ -23,8 +23,11 @@
 #include <vector>
 #include <algorithm>
 #include <cmath>
+#include <memory>
+#include <mutex>
 #include <ostream>
 #include "../../../api/data/data_type.h"
+#include "../../../api/data/request_handle.h"
 
 /// @brief FastLoader namespace
 namespace fl {
@@ -61,6 +64,18 @@ class AbstractViewData {
 
   FillingType fillingType_ = FillingType::CONSTANT;   ///< Type of filling used to construct the view
 
+  bool region_ = false; ///< True if the view is an arbitrary region, else the view is centered on a tile
+
+  bool preview_ = false; ///< True if the view is a preview upsampled from a coarser level
+
+  bool noCache_ = false; ///< True if the tiles loaded for the view should not be promoted in the cache
+
+  std::shared_ptr<RequestHandle> requestHandle_ = nullptr; ///< Handle of the request, nullptr if not cancellable
+
+  std::vector<std::shared_ptr<RequestHandle>>
+      coalescedHandles_{}; ///< Handles of the duplicate requests served by the view, nullptr if not cancellable
+  mutable std::mutex coalesceMutex_{}; ///< Mutex protecting the duplicate requests
+
  public:
   /// @brief ViewDataType Default constructor
   AbstractViewData() = default;
@@ -79,15 +94,25 @@ class AbstractViewData {
   /// @param viewData AbstractViewData to deep copy
   AbstractViewData(AbstractViewData<DataType> const &viewData) {
     //copy view metadata
-    initialize(
-        viewData.fullDimension_, viewData.tileDimension_,
-        viewData.radii_, viewData.indexCentralTile_, viewData.nbTilesPerDimension_,
-        viewData.dimensionNames_, viewData.fillingType_, viewData.level_
-    );
+    if (viewData.region_) {
+      initializeRegion(
+          viewData.fullDimension_, viewData.tileDimension_,
+          viewData.minPos_, viewData.viewDimension_, viewData.nbTilesPerDimension_,
+          viewData.dimensionNames_, viewData.fillingType_, viewData.level_
+      );
+    } else {
+      initialize(
+          viewData.fullDimension_, viewData.tileDimension_,
+          viewData.radii_, viewData.indexCentralTile_, viewData.nbTilesPerDimension_,
+          viewData.dimensionNames_, viewData.fillingType_, viewData.level_
+      );
+    }
 
     //those have not meaning outside of fast loader
-    nbOfRelease_ = viewData.nbOfRelease_;
+    nbOfRelease_ = viewData.nbOfRelease_ / (1 + viewData.coalescedHandles_.size());
     nbTilesToLoad_ = viewData.nbTilesToLoad_;
+    preview_ = viewData.preview_;
+    noCache_ = viewData.noCache_;
   }
 
   /// @brief Default destructor
@@ -122,6 +147,12 @@ class AbstractViewData {
     nbTilesToLoad_ = 0; // Really set when the TileRequests are made
     level_ = level;
     fillingType_ = fillingType;
+    region_ = false;
+    preview_ = false;
+    noCache_ = false;
+    requestHandle_ = nullptr;
+    nbOfRelease_ = nbOfReleasePerRequest();
+    coalescedHandles_.clear();
 
     minTileIndex_.reserve(nbDimensions);
     maxTileIndex_.reserve(nbDimensions);
@@ -172,6 +203,58 @@ class AbstractViewData {
     }
   }
 
+  /// @brief Initialise a view data with the metadata of an arbitrary region
+  /// @details The region is not centered on a tile and has no radius, the tiles overlapping the region are loaded and
+  /// the part of the region outside of the file is considered as back fill.
+  /// @param fullDimension File / full dimensions
+  /// @param tileDimension Tile dimensions
+  /// @param origin Region origin, global position in the file
+  /// @param extent Region extent
+  /// @param nbTilesPerDimension Number tiles per dimension
+  /// @param dimensionNames Dimension names
+  /// @param fillingType Type of filling
+  /// @param level Pyramidal level
+  void initializeRegion(std::vector<std::size_t> const &fullDimension, std::vector<std::size_t> const &tileDimension,
+                        std::vector<std::size_t> const &origin, std::vector<std::size_t> const &extent,
+                        std::vector<std::size_t> const &nbTilesPerDimension,
+                        std::vector<std::string> const &dimensionNames, FillingType fillingType, std::size_t level) {
+    clean();
+    size_t const nbDimensions = fullDimension.size();
+
+    dimensionNames_ = dimensionNames;
+
+    fullDimension_ = fullDimension;
+    tileDimension_ = tileDimension;
+    radii_ = std::vector<size_t>(nbDimensions, 0);
+    nbTilesPerDimension_ = nbTilesPerDimension;
+    viewDimension_ = extent;
+    minPos_ = origin;
+
+    releaseCount_ = 0;
+    nbTilesToLoad_ = 0; // Really set when the TileRequests are made
+    level_ = level;
+    fillingType_ = fillingType;
+    region_ = true;
+    preview_ = false;
+    noCache_ = false;
+    requestHandle_ = nullptr;
+    nbOfRelease_ = nbOfReleasePerRequest();
+    coalescedHandles_.clear();
+
+    indexCentralTile_.clear();
+    for (size_t dimension = 0; dimension < nbDimensions; ++dimension) {
+      maxPos_.push_back(std::min(origin.at(dimension) + extent.at(dimension), fullDimension_.at(dimension)));
+      indexCentralTile_.push_back(origin.at(dimension) / tileDimension_.at(dimension));
+      minTileIndex_.push_back(indexCentralTile_.back());
+      maxTileIndex_.push_back(
+          std::min(
+              (size_t) std::ceil((double) maxPos_.at(dimension) / (double) tileDimension_.at(dimension)),
+              nbTilesPerDimension_.at(dimension)));
+      frontFill_.push_back(0);
+      backFill_.push_back(extent.at(dimension) - (maxPos_.at(dimension) - minPos_.at(dimension)));
+    }
+  }
+
   /// @brief Data buffer accessor
   /// @return Data buffer
   [[nodiscard]] virtual DataType *data() const = 0;
@@ -223,10 +306,67 @@ class AbstractViewData {
   /// @brief Dimension names accessor
   /// @return Dimension names
   [[nodiscard]] std::vector<std::string> const &dimNames() const { return dimensionNames_; }
+  /// @brief Region flag accessor
+  /// @return True if the view is an arbitrary region, else false
+  [[nodiscard]] bool isRegion() const { return region_; }
+  /// @brief Preview flag accessor
+  /// @return True if the view is a preview upsampled from a coarser level, else false
+  [[nodiscard]] bool isPreview() const { return preview_; }
+  /// @brief No cache hint accessor
+  /// @return True if the tiles loaded for the view should not be promoted in the cache, else false
+  [[nodiscard]] bool noCache() const { return noCache_; }
+  /// @brief Request handle accessor
+  /// @return Handle of the request, nullptr if not cancellable
+  [[nodiscard]] std::shared_ptr<RequestHandle> const &requestHandle() const { return requestHandle_; }
+  /// @brief Cancelled flag accessor
+  /// @return True if the request of the view, and all the duplicate requests it serves, have been cancelled
+  [[nodiscard]] bool cancelled() const {
+    if (!requestHandle_ || !requestHandle_->cancelled()) { return false; }
+    std::lock_guard<std::mutex> lock(coalesceMutex_);
+    return std::all_of(coalescedHandles_.cbegin(), coalescedHandles_.cend(),
+                       [](auto const &handle) { return handle && handle->cancelled(); });
+  }
+  /// @brief Request handles accessor
+  /// @return Handles of the request and of the duplicate requests served by the view, nullptr if not cancellable
+  [[nodiscard]] std::vector<std::shared_ptr<RequestHandle>> requestHandles() const {
+    std::lock_guard<std::mutex> lock(coalesceMutex_);
+    std::vector<std::shared_ptr<RequestHandle>> requestHandles{requestHandle_};
+    requestHandles.insert(requestHandles.end(), coalescedHandles_.cbegin(), coalescedHandles_.cend());
+    return requestHandles;
+  }
 
   /// @brief Number of tiles to load setter
   /// @param nbTilesToLoad Number of tiles to load
   void nbTilesToLoad(size_t nbTilesToLoad) { nbTilesToLoad_ = nbTilesToLoad; }
+  /// @brief Preview flag setter
+  /// @param preview True if the view is a preview upsampled from a coarser level
+  void preview(bool preview) { preview_ = preview; }
+  /// @brief No cache hint setter
+  /// @param noCache True if the tiles loaded for the view should not be promoted in the cache
+  void noCache(bool noCache) { noCache_ = noCache; }
+  /// @brief Request handle setter
+  /// @param requestHandle Handle of the request, nullptr if not cancellable
+  void requestHandle(std::shared_ptr<RequestHandle> requestHandle) { requestHandle_ = std::move(requestHandle); }
+
+  /// @brief Serve a duplicate request with the view, the view will be sent, and should be released, once more
+  /// @details A view whose requests have all been cancelled can not serve a new request, its tiles may not be loaded.
+  /// @param requestHandle Handle of the duplicate request, nullptr if not cancellable
+  /// @return True if the view serves the request, else false
+  bool coalesce(std::shared_ptr<RequestHandle> requestHandle) {
+    std::lock_guard<std::mutex> lock(coalesceMutex_);
+    if (requestHandle_ && requestHandle_->cancelled()
+        && std::all_of(coalescedHandles_.cbegin(), coalescedHandles_.cend(),
+                       [](auto const &handle) { return handle && handle->cancelled(); })) {
+      return false;
+    }
+    nbOfRelease_ += nbOfReleasePerRequest();
+    coalescedHandles_.push_back(std::move(requestHandle));
+    return true;
+  }
+
+  /// @brief Account for the releases of the cancelled requests served by the view, their view is not sent
+  /// @param nbRequests Number of cancelled requests
+  void skipReleases(size_t nbRequests) { releaseCount_ += nbRequests * nbOfReleasePerRequest(); }
 
   /// @brief Output stream operator for the view data
   /// @param os Output stream
@@ -268,9 +408,19 @@ class AbstractViewData {
   /// @brief Return the memory (ViewData) to the memory manager
   virtual void returnToMemoryManager() = 0;
 
+  /// @brief Return the memory (ViewData) to the memory manager without being sent, whatever its number of releases
+  void discard() {
+    releaseCount_ = nbOfRelease_ - 1;
+    returnToMemoryManager();
+  }
+
 
 
  private:
+  /// @brief Number of releases of the view per request it serves
+  /// @return Number of releases per request
+  [[nodiscard]] size_t nbOfReleasePerRequest() const { return nbOfRelease_ / (1 + coalescedHandles_.size()); }
+
   /// @brief Clean the view data
   void clean() {
     dimensionNames_.clear();
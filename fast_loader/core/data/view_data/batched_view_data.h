@@ -0,0 +1,123 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_BATCHED_VIEW_DATA_H
+#define FAST_LOADER_BATCHED_VIEW_DATA_H
+
+#include <hedgehog/hedgehog.h>
+#include <algorithm>
+#include "abstract_view_data.h"
+#include "../../../api/graph/options/abstract_buffer_allocator.h"
+#include "../batch_buffer.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief View data stored in a slot of a batch buffer shared with other views
+/// @details The slot is bound when the view data leaves the memory manager and released when it is recycled.
+/// @tparam DataType Type of data inside the View
+template<class DataType>
+class BatchedViewData : public AbstractViewData<DataType>, public hh::ManagedMemory {
+ private:
+  DataType *data_ = nullptr; ///< Data, points to the slot in the batch or to the owned data of a copy
+  std::shared_ptr<BatchBuffer<DataType>> batch_ = nullptr; ///< Batch holding the view
+  size_t slot_ = 0; ///< Slot index in the batch
+  std::vector<DataType> ownedData_{}; ///< Data owned by a copy, a copy is not part of a batch
+
+ public:
+  /// @brief Default constructor
+  BatchedViewData() = default;
+
+  /// @brief Copy constructor, the data are copied and owned by the new instance
+  /// @param rhs BatchedViewData to copy
+  BatchedViewData(BatchedViewData const &rhs) : AbstractViewData<DataType>(rhs) {
+    if (rhs.data_) {
+      auto viewSize = std::accumulate(this->viewDims().cbegin(),
+                                      this->viewDims().cend(), (size_t) 1, std::multiplies<>());
+      ownedData_ = std::vector<DataType>(rhs.data_, rhs.data_ + viewSize);
+      data_ = ownedData_.data();
+    }
+  }
+
+  /// @brief Constructor from the number of releases
+  /// @param nbOfRelease Number of releases for a view
+  explicit BatchedViewData(size_t nbOfRelease) : AbstractViewData<DataType>(nbOfRelease) {}
+
+  /// @brief Constructor used by the FastLoaderMemoryManager, no buffer is allocated, the batches hold the data
+  /// @param sizesPerLevel Sizes of the view (number of elements) for all the pyramid's level [unused]
+  /// @param releasesPerLevel Number of releases for a view for all the pyramid's level
+  /// @param level Level of the pyramid
+  /// @param bufferAllocator Buffer allocator [unused]
+  BatchedViewData([[maybe_unused]] std::vector<size_t> sizesPerLevel, std::vector<size_t> releasesPerLevel,
+                  size_t level, [[maybe_unused]] std::shared_ptr<AbstractBufferAllocator> const &bufferAllocator)
+      : BatchedViewData(releasesPerLevel[level]) {}
+
+  /// @brief Destructor, release the slot if still bound
+  ~BatchedViewData() override { unbind(); }
+
+  /// @brief Raw data accessor
+  /// @return Raw data
+  DataType *data() const final { return data_; }
+
+  /// @brief Batch accessor
+  /// @return Batch holding the view, nullptr for a copy
+  std::shared_ptr<BatchBuffer<DataType>> const &batch() const { return batch_; }
+  /// @brief Slot accessor
+  /// @return Slot index in the batch
+  [[nodiscard]] size_t slot() const { return slot_; }
+
+  /// @brief Bind the view data to a slot of a batch
+  /// @param batch Batch holding the view
+  /// @param slot Slot index handed out by the batch
+  void bind(std::shared_ptr<BatchBuffer<DataType>> const &batch, size_t slot) {
+    batch_ = batch;
+    slot_ = slot;
+    data_ = batch_->data() + slot_ * batch_->viewSize();
+  }
+
+  /// @brief Increase the release count when the view is done processing
+  void postProcess() override { ++this->releaseCount_; }
+
+  /// @brief Recycling flag accessor used by hedgehog
+  /// @return True is the view can be recycled
+  bool canBeRecycled() override { return this->releaseCount_ == this->nbOfRelease_; }
+
+  /// @brief Release the slot when the view is recycled
+  void clean() override { unbind(); }
+
+  /// @brief Return the piece of memory to the memory manager
+  void returnToMemoryManager() final { hh::ManagedMemory::returnToMemoryManager(); }
+
+ private:
+  /// @brief Release the slot in the batch
+  void unbind() {
+    if (batch_) {
+      data_ = nullptr;
+      batch_->releaseSlot();
+      batch_ = nullptr;
+    }
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_BATCHED_VIEW_DATA_H
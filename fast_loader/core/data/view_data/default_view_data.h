@@ -22,6 +22,7 @@
 #include <hedgehog/hedgehog.h>
 #include <algorithm>
 #include "abstract_view_data.h"
+#include "../../buffer_allocator/buffer_allocation.h"
 
 /// @brief FastLoader namespace
 namespace fl {
@@ -34,6 +35,9 @@ template <class DataType>
  class DefaultViewData : public AbstractViewData<DataType>, public hh::ManagedMemory{
   private:
    DataType *data_ = nullptr; ///< Real Data
+   size_t capacity_ = 0; ///< Number of elements allocated in data_
+   size_t viewSize_ = 0; ///< Number of elements of a view, the buffer goes back to it when shrunk
+   std::shared_ptr<AbstractBufferAllocator> bufferAllocator_ = nullptr; ///< Buffer allocator, nullptr to use new[]
 
   public:
    /// @brief Default constructor
@@ -41,30 +45,39 @@ template <class DataType>
 
    /// @brief Copy constructor
    /// @param rhs DefaultViewData to copy
-   DefaultViewData(DefaultViewData const &rhs) : AbstractViewData<DataType>(rhs) {
+   DefaultViewData(DefaultViewData const &rhs) : AbstractViewData<DataType>(rhs), bufferAllocator_(rhs.bufferAllocator_) {
      auto viewSize = std::accumulate(this->viewDims().cbegin(),
                                      this->viewDims().cend(), (size_t)1, std::multiplies<>());
-     this->data_ = new DataType[viewSize];
+     this->data_ = allocateBuffer<DataType>(bufferAllocator_, viewSize);
+     this->capacity_ = viewSize;
+     this->viewSize_ = viewSize;
      std::copy_n(rhs.data_, viewSize, this->data_);
    }
 
    /// @brief Constructor from the size of the view and the number of releases
    /// @param viewSize Size of the view (number of elements)
    /// @param nbOfRelease Number of releases for a view
-   DefaultViewData(size_t viewSize, size_t nbOfRelease) : AbstractViewData<DataType>(nbOfRelease) {
-     this->data_ = new DataType[viewSize];
+   /// @param bufferAllocator Buffer allocator, nullptr to use new[] [default nullptr]
+   DefaultViewData(size_t viewSize, size_t nbOfRelease,
+                   std::shared_ptr<AbstractBufferAllocator> bufferAllocator = nullptr)
+       : AbstractViewData<DataType>(nbOfRelease), bufferAllocator_(std::move(bufferAllocator)) {
+     this->data_ = allocateBuffer<DataType>(bufferAllocator_, viewSize);
+     this->capacity_ = viewSize;
+     this->viewSize_ = viewSize;
    }
 
    /// @brief Constructor from the size of the view and the number of releases for all pyramid's level
    /// @param sizesPerLevel Sizes of the view (number of elements) for all the pyramid's level
    /// @param releasesPerLevel Number of releases for a view for all the pyramid's level
    /// @param level Level of the pyramid
-   DefaultViewData(std::vector<size_t> sizesPerLevel, std::vector<size_t> releasesPerLevel, size_t level) :
-       DefaultViewData(sizesPerLevel[level], releasesPerLevel[level]) {}
+   /// @param bufferAllocator Buffer allocator, nullptr to use new[]
+   DefaultViewData(std::vector<size_t> sizesPerLevel, std::vector<size_t> releasesPerLevel, size_t level,
+                   std::shared_ptr<AbstractBufferAllocator> bufferAllocator) :
+       DefaultViewData(sizesPerLevel[level], releasesPerLevel[level], std::move(bufferAllocator)) {}
 
    /// @brief DefaultViewData destructor, clean the raw array
    ~DefaultViewData() override {
-     delete[] this->data_;
+     deallocateBuffer(bufferAllocator_, this->data_, this->capacity_);
      this->data_ = nullptr;
    }
 
@@ -72,6 +85,33 @@ template <class DataType>
    /// @return Raw data
    DataType *data() const final { return data_; }
 
+   /// @brief Make sure the buffer can hold a number of elements, used for region requests
+   /// @details The buffer is only reallocated if it is too small, and is kept for the next requests once recycled
+   /// @param viewSize Number of elements needed
+   void reserve(size_t viewSize) {
+     if (viewSize > capacity_) {
+       deallocateBuffer(bufferAllocator_, this->data_, this->capacity_);
+       this->data_ = nullptr;
+       this->data_ = allocateBuffer<DataType>(bufferAllocator_, viewSize);
+       this->capacity_ = viewSize;
+     }
+   }
+
+   /// @brief Number of elements allocated accessor
+   /// @return Number of elements allocated, at least the view size
+   [[nodiscard]] size_t capacity() const { return capacity_; }
+
+   /// @brief Free a buffer grown for a region past a capacity, the buffer goes back to the view size
+   /// @param maxCapacity Number of elements the buffer can keep
+   void shrinkBuffer(size_t maxCapacity) {
+     if (capacity_ > std::max(maxCapacity, viewSize_)) {
+       deallocateBuffer(bufferAllocator_, this->data_, this->capacity_);
+       this->data_ = nullptr;
+       this->data_ = allocateBuffer<DataType>(bufferAllocator_, viewSize_);
+       this->capacity_ = viewSize_;
+     }
+   }
+
    /// @brief Increase the release count when the view is done processing
    void postProcess() override {
      ++this->releaseCount_;
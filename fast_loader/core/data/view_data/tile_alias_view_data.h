@@ -0,0 +1,121 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_TILE_ALIAS_VIEW_DATA_H
+#define FAST_LOADER_TILE_ALIAS_VIEW_DATA_H
+
+#include <hedgehog/hedgehog.h>
+#include <algorithm>
+#include "abstract_view_data.h"
+#include "../../../api/graph/options/abstract_buffer_allocator.h"
+#include "../cached_tile.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief View data aliasing the buffer of a cached tile instead of owning a copy of it
+/// @details The cached tile is read pinned from the time it is aliased until the view data is recycled by the memory
+/// manager, so the cache can not recycle it while the view is in use. The pin is shared, the tile can still be requested
+/// and aliased by other views.
+/// @tparam DataType Type of data inside the View
+template<class DataType>
+class TileAliasViewData : public AbstractViewData<DataType>, public hh::ManagedMemory {
+ private:
+  DataType *data_ = nullptr; ///< Aliased data, points to the cached tile buffer or to the owned data of a copy
+  std::shared_ptr<CachedTile<DataType>> cachedTile_ = nullptr; ///< Pinned cached tile
+  std::vector<DataType> ownedData_{}; ///< Data owned by a copy, a copy does not pin any tile
+
+ public:
+  /// @brief Default constructor
+  TileAliasViewData() = default;
+
+  /// @brief Copy constructor, the data are copied and owned by the new instance
+  /// @param rhs TileAliasViewData to copy
+  TileAliasViewData(TileAliasViewData const &rhs) : AbstractViewData<DataType>(rhs) {
+    if (rhs.data_) {
+      auto viewSize = std::accumulate(this->viewDims().cbegin(),
+                                      this->viewDims().cend(), (size_t) 1, std::multiplies<>());
+      ownedData_ = std::vector<DataType>(rhs.data_, rhs.data_ + viewSize);
+      data_ = ownedData_.data();
+    }
+  }
+
+  /// @brief Constructor from the number of releases
+  /// @param nbOfRelease Number of releases for a view
+  explicit TileAliasViewData(size_t nbOfRelease) : AbstractViewData<DataType>(nbOfRelease) {}
+
+  /// @brief Constructor used by the FastLoaderMemoryManager, no buffer is allocated
+  /// @param sizesPerLevel Sizes of the view (number of elements) for all the pyramid's level [unused]
+  /// @param releasesPerLevel Number of releases for a view for all the pyramid's level
+  /// @param level Level of the pyramid
+  /// @param bufferAllocator Buffer allocator [unused]
+  TileAliasViewData([[maybe_unused]] std::vector<size_t> sizesPerLevel, std::vector<size_t> releasesPerLevel,
+                    size_t level, [[maybe_unused]] std::shared_ptr<AbstractBufferAllocator> const &bufferAllocator)
+      : TileAliasViewData(releasesPerLevel[level]) {}
+
+  /// @brief Destructor, unpin the cached tile if still aliased
+  ~TileAliasViewData() override { unpin(); }
+
+  /// @brief Raw data accessor
+  /// @return Raw data
+  DataType *data() const final { return data_; }
+
+  /// @brief Aliased cached tile accessor
+  /// @return Aliased cached tile, nullptr if none
+  std::shared_ptr<CachedTile<DataType>> const &cachedTile() const { return cachedTile_; }
+
+  /// @brief Alias a cached tile, its semaphore should be held while aliasing, the read pin is removed when the view is
+  /// recycled
+  /// @param cachedTile Cached tile to alias
+  void alias(std::shared_ptr<CachedTile<DataType>> const &cachedTile) {
+    cachedTile_ = cachedTile;
+    cachedTile_->pinAlias();
+    data_ = cachedTile_->data()->data();
+  }
+
+  /// @brief Increase the release count when the view is done processing
+  void postProcess() override { ++this->releaseCount_; }
+
+  /// @brief Recycling flag accessor used by hedgehog
+  /// @return True is the view can be recycled
+  bool canBeRecycled() override { return this->releaseCount_ == this->nbOfRelease_; }
+
+  /// @brief Unpin the aliased tile when the view is recycled
+  void clean() override { unpin(); }
+
+  /// @brief Return the piece of memory to the memory manager
+  void returnToMemoryManager() final { hh::ManagedMemory::returnToMemoryManager(); }
+
+ private:
+  /// @brief Remove the read pin of the aliased cached tile
+  void unpin() {
+    if (cachedTile_) {
+      data_ = nullptr;
+      cachedTile_->unpinAlias();
+      cachedTile_ = nullptr;
+    }
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_TILE_ALIAS_VIEW_DATA_H
@@ -25,6 +25,7 @@
 #include <hedgehog/hedgehog.h>
 
 #include "abstract_view_data.h"
+#include "../../../api/graph/options/abstract_buffer_allocator.h"
 
 /// @brief FastLoader namespace
 namespace fl {
@@ -46,6 +47,7 @@ class UnifiedViewData : public AbstractViewData<DataType>, public hh::ManagedMem
   cudaEvent_t event_ = {}; ///< cudaEvent useful for synchronizing data copying between host and device
   bool eventCreated_ = false; ///< flag used to track if the event has been created
   size_t viewSize_ = 0; ///< The total size of the view
+  size_t initialViewSize_ = 0; ///< Number of elements of a view, the buffer goes back to it when shrunk
 
  public:
   /// @brief Default constructor
@@ -55,6 +57,7 @@ class UnifiedViewData : public AbstractViewData<DataType>, public hh::ManagedMem
   /// @param rhs DefaultViewData to copy
   UnifiedViewData(UnifiedViewData const &rhs) : AbstractViewData<DataType>(rhs) {
     viewSize_ = std::accumulate(this->viewDims().cbegin(), this->viewDims().cend(), (size_t) 1, std::multiplies<>());
+    initialViewSize_ = viewSize_;
     checkCudaErrors(cudaMallocManaged((void **) &this->data_, sizeof(DataType) * viewSize_));
     std::copy_n(rhs.data_, viewSize_, this->data_);
   }
@@ -63,7 +66,7 @@ class UnifiedViewData : public AbstractViewData<DataType>, public hh::ManagedMem
   /// @param viewSize Size of the view (number of elements)
   /// @param numberOfRelease Number of releases for a view
   UnifiedViewData(size_t viewSize, size_t nbOfRelease) : AbstractViewData<DataType>(nbOfRelease),
-                                                             viewSize_(viewSize) {
+                                                             viewSize_(viewSize), initialViewSize_(viewSize) {
     checkCudaErrors(cudaMallocManaged((void **) &this->data_, sizeof(DataType) * viewSize));
   }
 
@@ -71,7 +74,9 @@ class UnifiedViewData : public AbstractViewData<DataType>, public hh::ManagedMem
   /// @param sizesPerLevel Sizes of the view (number of elements) for all the pyramid's level
   /// @param releasesPerLevel Number of releases for a view for all the pyramid's level
   /// @param level Level of the pyramid
-  UnifiedViewData(std::vector<size_t> sizesPerLevel, std::vector<size_t> releasesPerLevel, size_t level) :
+  /// @param bufferAllocator Buffer allocator [unused], the data are allocated in CUDA managed memory
+  UnifiedViewData(std::vector<size_t> sizesPerLevel, std::vector<size_t> releasesPerLevel, size_t level,
+                  [[maybe_unused]] std::shared_ptr<AbstractBufferAllocator> const &bufferAllocator) :
       UnifiedViewData(sizesPerLevel[level], releasesPerLevel[level]) {}
 
   /// @brief DefaultViewData destructor, will destroy created events and cudaFree raw array
@@ -108,6 +113,27 @@ class UnifiedViewData : public AbstractViewData<DataType>, public hh::ManagedMem
   /// @return Raw data
   DataType *data() const final { return data_; }
 
+  /// @brief Make sure the buffer can hold a number of elements, used for region requests
+  /// @details The buffer is only reallocated if it is too small, and is kept for the next requests once recycled
+  /// @param viewSize Number of elements needed
+  void reserve(size_t viewSize) {
+    if (viewSize > viewSize_) {
+      checkCudaErrors(cudaFree(this->data_));
+      checkCudaErrors(cudaMallocManaged((void **) &this->data_, sizeof(DataType) * viewSize));
+      viewSize_ = viewSize;
+    }
+  }
+
+  /// @brief Free a buffer grown for a region past a capacity, the buffer goes back to the view size
+  /// @param maxCapacity Number of elements the buffer can keep
+  void shrinkBuffer(size_t maxCapacity) {
+    if (viewSize_ > std::max(maxCapacity, initialViewSize_)) {
+      checkCudaErrors(cudaFree(this->data_));
+      checkCudaErrors(cudaMallocManaged((void **) &this->data_, sizeof(DataType) * initialViewSize_));
+      viewSize_ = initialViewSize_;
+    }
+  }
+
   /// @brief ViewRequest used method, to increment the releaseCount
   void postProcess() override { ++this->releaseCount_; }
 
@@ -0,0 +1,287 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_DISK_TILE_CACHE_H
+#define FAST_LOADER_DISK_TILE_CACHE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#ifdef __linux__
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif //__linux__
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Persistent tile cache, spilling the tiles loaded from the file to a memory-mapped slab file
+/// @details The slab file is named after the hash of the identity of the tiles (file, size and modification date,
+/// level, tile dimensions, ...), so it is reused across runs. It is made of a header holding the identity, a slot table
+/// holding the index and the last use of the tile in each slot, and the tiles data. The least recently used tile is
+/// replaced once all the slots are used, skipping the slots being read. The tiles are copied outside the lock: a slot is
+/// reserved while it is written and only published once written, and a slot being read is not replaced. A slot is
+/// invalidated while it is written, so a process killed while writing a tile does not leave a corrupted tile. The slab
+/// file is only synced to the disk when the cache is closed, a system crash may leave corrupted tiles. The slab file is
+/// locked by the process using it, another process opening the same slab file runs without disk cache. Only available
+/// on Linux, the cache is disabled on the other systems.
+/// @tparam DataType Type of the tile elements
+template<class DataType>
+class DiskTileCache {
+ private:
+  static size_t constexpr IdentitySize = 1024; ///< Maximum size of the identity saved in the header
+  static char constexpr Magic[8] = "FLSLAB1"; ///< Slab file signature
+
+  /// @brief Slab file header
+  struct Header {
+    char magic[8]; ///< Slab file signature
+    uint64_t tileBytes; ///< Size of a tile in bytes
+    uint64_t nbSlots; ///< Number of slots
+    uint64_t clock; ///< Use counter, stamping the slots
+    char identity[IdentitySize]; ///< Identity of the tiles, truncated
+  };
+
+  /// @brief Slot table entry
+  struct Slot {
+    uint64_t index; ///< Flattened tile index + 1, 0 for an empty slot
+    uint64_t stamp; ///< Last use of the slot
+  };
+
+  std::filesystem::path path_{}; ///< Slab file path
+  size_t const tileBytes_ = 0; ///< Size of a tile in bytes
+  size_t nbSlots_ = 0; ///< Number of slots
+  int fd_ = -1; ///< Slab file descriptor
+  uint8_t *mapping_ = nullptr; ///< Slab file mapping, nullptr if the cache is disabled
+  size_t mappingBytes_ = 0; ///< Slab file size
+  size_t dataOffset_ = 0; ///< Offset of the tiles data in the slab file
+  Header *header_ = nullptr; ///< Slab file header
+  Slot *slots_ = nullptr; ///< Slot table
+  std::unordered_map<uint64_t, size_t> slotPerIndex_{}; ///< Slot holding a flattened tile index
+  std::set<std::pair<uint64_t, size_t>> lru_{}; ///< Used slots ordered by last use
+  std::vector<size_t> freeSlots_{}; ///< Empty slots
+  std::vector<size_t> nbReaders_{}; ///< Number of tiles being read per slot, a slot being read is not replaced
+  std::set<size_t> writtenIndices_{}; ///< Flattened tile indices being written
+  mutable std::mutex mutex_{}; ///< Disk cache mutex, guarding the slot table, not the tiles data
+  size_t
+      hit_ = 0, ///< Number of tiles read from the slab file
+      miss_ = 0; ///< Number of tiles not found in the slab file
+
+ public:
+  /// @brief Open or create the slab file of a set of tiles
+  /// @param directory Directory holding the slab files
+  /// @param identity Identity of the tiles, the slab file is reused if the identity and the geometry match
+  /// @param nbElementsTile Number of elements in a tile
+  /// @param capacityBytes Maximum size of the tiles data in bytes
+  /// @throw std::runtime_error If the slab file can not be created or mapped
+  DiskTileCache(std::filesystem::path const &directory, std::string const &identity, size_t nbElementsTile,
+                size_t capacityBytes) : tileBytes_(nbElementsTile * sizeof(DataType)) {
+    std::ostringstream name;
+    name << "fast_loader_" << std::hex << std::hash<std::string>{}(identity) << ".slab";
+    path_ = directory / name.str();
+    nbSlots_ = tileBytes_ ? capacityBytes / tileBytes_ : 0;
+    if (nbSlots_ == 0) { return; }
+#ifdef __linux__
+    fd_ = ::open(path_.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd_ < 0) { fail("open"); }
+    // Another process is using the slab file, run without disk cache
+    if (flock(fd_, LOCK_EX | LOCK_NB) != 0) {
+      ::close(fd_);
+      fd_ = -1;
+      return;
+    }
+    auto const pageSize = (size_t) sysconf(_SC_PAGESIZE);
+    dataOffset_ = (sizeof(Header) + nbSlots_ * sizeof(Slot) + pageSize - 1) / pageSize * pageSize;
+    mappingBytes_ = dataOffset_ + nbSlots_ * tileBytes_;
+
+    Header expected{};
+    std::memcpy(expected.magic, Magic, sizeof(Magic));
+    expected.tileBytes = tileBytes_;
+    expected.nbSlots = nbSlots_;
+    std::strncpy(expected.identity, identity.c_str(), IdentitySize - 1);
+
+    // Reset the slab file if it does not hold the same tiles with the same geometry
+    Header existing{};
+    bool const reuse = ::pread(fd_, &existing, sizeof(Header), 0) == (ssize_t) sizeof(Header)
+        && std::memcmp(existing.magic, expected.magic, sizeof(Magic)) == 0
+        && existing.tileBytes == expected.tileBytes && existing.nbSlots == expected.nbSlots
+        && std::strncmp(existing.identity, expected.identity, IdentitySize) == 0;
+    if (!reuse && (::ftruncate(fd_, 0) != 0 || ::ftruncate(fd_, (off_t) mappingBytes_) != 0)) {
+      fail("resize");
+    }
+
+    void *mapping = ::mmap(nullptr, mappingBytes_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (mapping == MAP_FAILED) { fail("map"); }
+    mapping_ = static_cast<uint8_t *>(mapping);
+    header_ = reinterpret_cast<Header *>(mapping_);
+    slots_ = reinterpret_cast<Slot *>(mapping_ + sizeof(Header));
+    if (!reuse) { *header_ = expected; }
+    nbReaders_.resize(nbSlots_, 0);
+
+    for (size_t slot = 0; slot < nbSlots_; ++slot) {
+      if (slots_[slot].index) {
+        slotPerIndex_.emplace(slots_[slot].index - 1, slot);
+        lru_.emplace(slots_[slot].stamp, slot);
+      } else { freeSlots_.push_back(slot); }
+    }
+#endif //__linux__
+  }
+
+  /// @brief Unmap and unlock the slab file
+  virtual ~DiskTileCache() {
+#ifdef __linux__
+    if (mapping_) {
+      ::msync(mapping_, mappingBytes_, MS_SYNC);
+      ::munmap(mapping_, mappingBytes_);
+    }
+    if (fd_ >= 0) { ::close(fd_); }
+#endif //__linux__
+  }
+
+  DiskTileCache(DiskTileCache const &) = delete;
+  DiskTileCache &operator=(DiskTileCache const &) = delete;
+
+  /// @brief Enabled flag accessor
+  /// @return True if the slab file is used, false if no tile fits, if another process uses it, or if not on Linux
+  [[nodiscard]] bool enabled() const { return mapping_ != nullptr; }
+  /// @brief Slab file path accessor
+  /// @return Slab file path
+  [[nodiscard]] std::filesystem::path const &path() const { return path_; }
+  /// @brief Number of tiles read from the slab file accessor
+  /// @return Number of tiles read from the slab file
+  [[nodiscard]] size_t hit() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hit_;
+  }
+  /// @brief Number of tiles not found in the slab file accessor
+  /// @return Number of tiles not found in the slab file
+  [[nodiscard]] size_t miss() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return miss_;
+  }
+  /// @brief Number of tiles held accessor
+  /// @return Number of tiles held in the slab file
+  [[nodiscard]] size_t nbTiles() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return slotPerIndex_.size();
+  }
+
+  /// @brief Read a tile from the slab file, the copy is done outside the lock
+  /// @param index Flattened tile index
+  /// @param data Tile elements to fill
+  /// @param nbElements Number of elements
+  /// @return True if the tile has been read, else false
+  bool load(size_t index, DataType *data, size_t nbElements) {
+    if (!enabled() || nbElements * sizeof(DataType) != tileBytes_) { return false; }
+    size_t slot;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = slotPerIndex_.find(index);
+      if (it == slotPerIndex_.end()) {
+        ++miss_;
+        return false;
+      }
+      ++hit_;
+      slot = it->second;
+      ++nbReaders_.at(slot);
+      touch(slot);
+    }
+    std::memcpy(data, mapping_ + dataOffset_ + slot * tileBytes_, tileBytes_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    --nbReaders_.at(slot);
+    return true;
+  }
+
+  /// @brief Write a tile to the slab file, replacing the least recently used tile not being read if all the slots are
+  /// used, the copy is done outside the lock
+  /// @details The tile is not written if it is already held or being written, or if all the slots are being read or
+  /// written.
+  /// @param index Flattened tile index
+  /// @param data Tile elements
+  /// @param nbElements Number of elements
+  void store(size_t index, DataType const *data, size_t nbElements) {
+    if (!enabled() || nbElements * sizeof(DataType) != tileBytes_) { return; }
+    size_t slot;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (slotPerIndex_.contains(index) || writtenIndices_.contains(index)) { return; }
+      if (!freeSlots_.empty()) {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+      } else {
+        auto victim = std::find_if(lru_.begin(), lru_.end(), [this](auto const &used) {
+          return nbReaders_.at(used.second) == 0;
+        });
+        if (victim == lru_.end()) { return; }
+        slot = victim->second;
+        lru_.erase(victim);
+        slotPerIndex_.erase(slots_[slot].index - 1);
+      }
+      // Invalidate the slot while it is written, it is neither free nor used so it is not taken by another thread
+      slots_[slot].index = 0;
+      writtenIndices_.insert(index);
+    }
+    std::memcpy(mapping_ + dataOffset_ + slot * tileBytes_, data, tileBytes_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    writtenIndices_.erase(index);
+    slots_[slot].index = index + 1;
+    slots_[slot].stamp = ++header_->clock;
+    lru_.emplace(slots_[slot].stamp, slot);
+    slotPerIndex_.emplace(index, slot);
+  }
+
+ private:
+  /// @brief Mark a used slot as the most recently used
+  /// @param slot Slot to mark
+  void touch(size_t slot) {
+    lru_.erase({slots_[slot].stamp, slot});
+    slots_[slot].stamp = ++header_->clock;
+    lru_.emplace(slots_[slot].stamp, slot);
+  }
+
+  /// @brief Close the slab file after a failed operation and throw
+  /// @param operation Failed operation
+  /// @throw std::runtime_error Always
+  [[noreturn]] void fail(std::string const &operation) {
+    std::ostringstream oss;
+    oss << "Can not " << operation << " the disk cache slab file " << path_;
+#ifdef __linux__
+    oss << ": " << std::strerror(errno);
+    if (fd_ >= 0) { ::close(fd_); }
+#endif //__linux__
+    throw std::runtime_error(oss.str());
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_DISK_TILE_CACHE_H
@@ -19,19 +19,117 @@
 #ifndef FAST_LOADER_FAST_LOADER_MEMORY_MANAGER_H
 #define FAST_LOADER_FAST_LOADER_MEMORY_MANAGER_H
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include <utility>
 #include <hedgehog/hedgehog.h>
+#include "../api/graph/options/abstract_buffer_allocator.h"
+#include "../api/data/view_pool_statistics.h"
 
 /// @brief FastLoader namespace
 namespace fl {
 /// @brief FastLoader internal namespace
 namespace internal {
 
-/// @brief static memory manager used to generate all the views for all levels at graph initialization
+/// @brief Counters of the view pool of a level, shared by the memory managers of the level
+struct ViewPoolCounters {
+  std::atomic<size_t>
+      nbViews{0}, ///< Number of views currently allocated
+      nbGrown{0}, ///< Number of views allocated past the number of views available
+      nbShrunk{0}, ///< Number of unused views freed
+      nbBlocked{0}, ///< Number of view requests that found the pool empty
+      blockedTimeNs{0}; ///< Time in nanoseconds spent waiting for a view on an empty pool
+
+  /// @brief Statistics accessor
+  /// @return Snapshot of the counters
+  [[nodiscard]] ViewPoolStatistics statistics() const {
+    return {nbViews, nbGrown, nbShrunk, nbBlocked, std::chrono::nanoseconds(blockedTimeNs)};
+  }
+};
+
+/// @brief Sizing of the view pools, shared by the memory managers of all levels
+/// @details The elastic pools register a wake-up, called when the tile loaders go idle and periodically by the
+/// ViewPoolTrimmer, to free their unused views and to wake the view requests waiting for the tile loaders to go idle.
+struct ViewPoolPolicy {
+  std::vector<size_t> maxViewsPerLevel{}; ///< Number of views the pool can grow to per level
+  std::vector<size_t> maxBufferSizePerLevel{}; ///< Number of elements a recycled view keeps per level, a buffer grown
+                                                ///< past it for a region is freed
+  std::chrono::milliseconds idleTimeout{}; ///< Time after which an unused view past the views available is freed
+  std::function<bool()> pipelineIdle{}; ///< Test if the tile loaders are idle, the pool only grows then
+  std::vector<std::shared_ptr<ViewPoolCounters>> countersPerLevel{}; ///< Counters per level
+
+  /// @brief Register the wake-up of an elastic pool
+  /// @param wake Wake-up of the pool
+  void addPool(std::function<void()> wake) {
+    std::lock_guard<std::mutex> lock(poolsMutex_);
+    pools_.push_back(std::move(wake));
+  }
+
+  /// @brief Wake the elastic pools, the pools mutex is taken before the mutex of a pool
+  void wakePools() {
+    std::lock_guard<std::mutex> lock(poolsMutex_);
+    for (auto const &wake : pools_) { wake(); }
+  }
+
+ private:
+  std::mutex poolsMutex_{}; ///< Mutex protecting the pools wake-ups
+  std::vector<std::function<void()>> pools_{}; ///< Wake-ups of the elastic pools
+};
+
+/// @brief Thread waking the elastic pools every half idle timeout, so the unused views are freed even when no view is
+/// requested or returned anymore
+class ViewPoolTrimmer {
+ private:
+  std::mutex mutex_{}; ///< Mutex protecting the stop flag
+  std::condition_variable condition_{}; ///< Condition notified to stop
+  bool stop_ = false; ///< Stop flag
+  std::thread thread_{}; ///< Trimming thread
+
+ public:
+  /// @brief Start the trimming thread
+  /// @param policy Sizing of the view pools
+  explicit ViewPoolTrimmer(std::shared_ptr<ViewPoolPolicy> const &policy) {
+    auto const period = std::max(std::chrono::milliseconds(1), policy->idleTimeout / 2);
+    thread_ = std::thread([this, policy, period]() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (!condition_.wait_for(lock, period, [this]() { return stop_; })) {
+        lock.unlock();
+        policy->wakePools();
+        lock.lock();
+      }
+    });
+  }
+
+  /// @brief Stop and join the trimming thread
+  virtual ~ViewPoolTrimmer() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    condition_.notify_one();
+    if (thread_.joinable()) { thread_.join(); }
+  }
+
+  ViewPoolTrimmer(ViewPoolTrimmer const &) = delete;
+  ViewPoolTrimmer &operator=(ViewPoolTrimmer const &) = delete;
+};
+
+/// @brief Memory manager used to generate the views of a level
+/// @details The pool starts with the number of views available for the level. If the pool is elastic (maximum number
+/// of views above the number of views available) and a view is requested while the pool is empty and the tile loaders
+/// are idle, the views are held downstream and the pipeline starves, so a new view is allocated, up to the maximum. A
+/// request waiting on an empty elastic pool is woken when a view is returned or when the tile loaders go idle. The views
+/// allocated past the number of views available are freed once unused for the idle timeout, tested when a view is
+/// requested or returned, when the tile loaders go idle, and periodically by the ViewPoolTrimmer. The most recently
+/// returned view is handed out first, so the unused ones are the oldest.
 /// @tparam ViewDataType Internal view's type
 template<class ViewDataType>
-class FastLoaderMemoryManager
-    : public hh::StaticMemoryManager<ViewDataType, std::vector<size_t>, std::vector<size_t>, size_t> {
+class FastLoaderMemoryManager : public hh::AbstractMemoryManager {
  private:
   size_t
       level_ = {}; ///< Memory's manager level
@@ -39,29 +137,167 @@ class FastLoaderMemoryManager
       viewAvailablePerLevel_ = {}, ///< Number of views available for all levels
   viewSizePerLevel_ = {}, ///< AbstractView's size for all levels
   releasePerLevel_ = {}; ///< Number of release for all levels
+  std::shared_ptr<AbstractBufferAllocator> const
+      bufferAllocator_ = nullptr; ///< Allocator of the views buffers, nullptr for the default allocation
+  std::shared_ptr<ViewPoolPolicy> const
+      policy_ = nullptr; ///< Sizing of the view pools, nullptr for a static pool without counters
+
+  std::deque<std::pair<std::shared_ptr<ViewDataType>, std::chrono::steady_clock::time_point>>
+      views_{}; ///< Available views, with the time they have been returned
+  size_t nbViews_ = 0; ///< Number of views allocated by this memory manager
+  bool initialized_ = false; ///< Set once the views available have been allocated
+  std::mutex poolMutex_{}; ///< Mutex protecting the pool
+  std::condition_variable poolCondition_{}; ///< Condition notified when a view is returned or the pool woken
+
  public:
 /// @brief FastLoader memory manager constructor
 /// @param viewAvailablePerLevel Number of views available for all levels
 /// @param viewSizePerLevel AbstractView's size for all levels
 /// @param releasePerLevel Number of release for all levels
+/// @param bufferAllocator Allocator of the views buffers, nullptr for the default allocation
+/// @param policy Sizing of the view pools, nullptr for a static pool without counters [default nullptr]
 /// @param level Memory manager level
   FastLoaderMemoryManager(
       const std::vector<size_t> &viewAvailablePerLevel,
       const std::vector<size_t> &viewSizePerLevel,
       const std::vector<size_t> &releasePerLevel,
+      std::shared_ptr<AbstractBufferAllocator> const &bufferAllocator = nullptr,
+      std::shared_ptr<ViewPoolPolicy> const &policy = nullptr,
       size_t level = 0) :
-      hh::StaticMemoryManager<ViewDataType, std::vector<size_t>, std::vector<size_t>, size_t>
-          (viewAvailablePerLevel[level], viewSizePerLevel, releasePerLevel, level),
+      hh::AbstractMemoryManager(viewAvailablePerLevel[level]),
       level_(level),
       viewAvailablePerLevel_(viewAvailablePerLevel),
       viewSizePerLevel_(viewSizePerLevel),
-      releasePerLevel_(releasePerLevel) { }
+      releasePerLevel_(releasePerLevel),
+      bufferAllocator_(bufferAllocator),
+      policy_(policy) { }
+
+/// @brief Allocate the views available for the level
+  void initialize() override {
+    {
+      std::lock_guard<std::mutex> lock(poolMutex_);
+      if (initialized_) { return; }
+      initialized_ = true;
+      for (size_t view = 0; view < std::max((size_t) 1, viewAvailablePerLevel_.at(level_)); ++view) {
+        views_.emplace_back(newView(), std::chrono::steady_clock::now());
+      }
+    }
+    if (elastic()) {
+      // Registered outside the pool mutex, the policy takes its mutex first. The policy does not own the pool.
+      policy_->addPool(
+          [pool = std::weak_ptr<FastLoaderMemoryManager>(
+              std::dynamic_pointer_cast<FastLoaderMemoryManager>(this->shared_from_this()))]() {
+            if (auto const memoryManager = pool.lock()) { memoryManager->wake(); }
+          });
+    }
+  }
+
+/// @brief Get an available view, blocking until one is returned, or allocate one if the pool can grow
+/// @return An available view
+  std::shared_ptr<hh::ManagedMemory> getManagedMemory() override {
+    std::unique_lock<std::mutex> lock(poolMutex_);
+    std::shared_ptr<ViewDataType> view = nullptr;
+    if (views_.empty()) {
+      auto const begin = std::chrono::steady_clock::now();
+      if (counters()) { ++counters()->nbBlocked; }
+      while (views_.empty() && !view) {
+        if (canGrow()) {
+          view = newView();
+          ++counters()->nbGrown;
+        } else {
+          poolCondition_.wait(lock);
+        }
+      }
+      if (counters()) {
+        counters()->blockedTimeNs += (size_t) std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - begin).count();
+      }
+    }
+    if (!view) {
+      view = views_.back().first;
+      views_.pop_back();
+    }
+    shrink();
+    lock.unlock();
+    view->preProcess();
+    return view;
+  }
+
+/// @brief Return a view to the pool if it can be recycled
+/// @param managedMemory View to return
+  void recycleMemory(std::shared_ptr<hh::ManagedMemory> const &managedMemory) override {
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    managedMemory->postProcess();
+    if (managedMemory->canBeRecycled()) {
+      managedMemory->clean();
+      auto view = std::dynamic_pointer_cast<ViewDataType>(managedMemory);
+      if constexpr (requires(ViewDataType &viewData) { viewData.shrinkBuffer(size_t{}); }) {
+        if (policy_) { view->shrinkBuffer(policy_->maxBufferSizePerLevel.at(level_)); }
+      }
+      views_.emplace_back(std::move(view), std::chrono::steady_clock::now());
+      shrink();
+      poolCondition_.notify_one();
+    }
+  }
+
+/// @brief Managed type accessor
+/// @return Name of the managed type
+  [[nodiscard]] std::string managedType() const override { return "FastLoader view pool"; }
 
 /// @brief Copy method to copy the first memory manager instance for all levels
 /// @return Copy of the current AbstractMemoryManager
   std::shared_ptr<hh::AbstractMemoryManager> copy() override {
     return std::make_shared<FastLoaderMemoryManager<ViewDataType>>(
-        viewAvailablePerLevel_, viewSizePerLevel_, releasePerLevel_, level_++);
+        viewAvailablePerLevel_, viewSizePerLevel_, releasePerLevel_, bufferAllocator_, policy_, level_++);
+  }
+
+ private:
+/// @brief Counters accessor
+/// @return Counters of the level, nullptr if not used
+  [[nodiscard]] ViewPoolCounters *counters() const {
+    return policy_ ? policy_->countersPerLevel.at(level_).get() : nullptr;
+  }
+
+/// @brief Test if the pool can grow
+/// @return True if the pool is elastic
+  [[nodiscard]] bool elastic() const {
+    return policy_ && policy_->maxViewsPerLevel.at(level_) > viewAvailablePerLevel_.at(level_);
+  }
+
+/// @brief Test if a view can be allocated, the pool should be elastic, not full, and the tile loaders idle
+/// @return True if a view can be allocated
+  [[nodiscard]] bool canGrow() const {
+    return elastic() && nbViews_ < policy_->maxViewsPerLevel.at(level_) && policy_->pipelineIdle();
+  }
+
+/// @brief Allocate a view
+/// @return New view
+  std::shared_ptr<ViewDataType> newView() {
+    auto view = std::make_shared<ViewDataType>(viewSizePerLevel_, releasePerLevel_, level_, bufferAllocator_);
+    view->memoryManager(this->shared_from_this());
+    ++nbViews_;
+    if (counters()) { ++counters()->nbViews; }
+    return view;
+  }
+
+/// @brief Free the unused views and wake the requests waiting for a view, to allocate one if the tile loaders are idle
+  void wake() {
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    shrink();
+    poolCondition_.notify_all();
+  }
+
+/// @brief Free the views past the views available that have not been used for the idle timeout, oldest first
+  void shrink() {
+    if (!elastic()) { return; }
+    auto const now = std::chrono::steady_clock::now();
+    while (nbViews_ > viewAvailablePerLevel_.at(level_) && !views_.empty()
+        && now - views_.front().second >= policy_->idleTimeout) {
+      views_.pop_front();
+      --nbViews_;
+      --counters()->nbViews;
+      ++counters()->nbShrunk;
+    }
   }
 };
 
@@ -0,0 +1,102 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_FREQUENCY_SKETCH_H
+#define FAST_LOADER_FREQUENCY_SKETCH_H
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Count-min sketch estimating the access frequency of the tiles, used for the TinyLFU cache admission
+/// @details The counters saturate at 15 and are halved once the number of increments reaches ten times the number of
+/// tiles in the cache, so the estimations follow the recent popularity of the tiles.
+class FrequencySketch {
+ private:
+  static size_t constexpr nbRows_ = 4; ///< Number of hashed rows
+  static uint8_t constexpr maxCount_ = 15; ///< Saturation value of a counter
+  size_t const
+      width_{}, ///< Number of counters per row, power of two
+      sampleSize_{}; ///< Number of increments before the counters are halved
+  std::vector<uint8_t> counters_{}; ///< Counters, row after row
+  size_t nbIncrements_ = 0; ///< Number of increments since the last halving
+
+ public:
+  /// @brief Frequency sketch constructor
+  /// @param nbTilesCache Number of tiles in the cache
+  explicit FrequencySketch(size_t nbTilesCache)
+      : width_(std::bit_ceil(std::max((size_t) 256, 8 * nbTilesCache))),
+        sampleSize_(10 * std::max((size_t) 1, nbTilesCache)),
+        counters_(nbRows_ * width_, 0) {}
+
+  /// @brief Record an access to a tile
+  /// @param key Flattened tile index
+  void increment(size_t key) {
+    bool incremented = false;
+    for (size_t row = 0; row < nbRows_; ++row) {
+      auto &counter = counters_.at(row * width_ + slot(key, row));
+      if (counter < maxCount_) {
+        ++counter;
+        incremented = true;
+      }
+    }
+    if (incremented && ++nbIncrements_ >= sampleSize_) { age(); }
+  }
+
+  /// @brief Estimate the access frequency of a tile
+  /// @param key Flattened tile index
+  /// @return Estimated number of recent accesses
+  [[nodiscard]] uint8_t estimate(size_t key) const {
+    uint8_t frequency = maxCount_;
+    for (size_t row = 0; row < nbRows_; ++row) {
+      frequency = std::min(frequency, counters_.at(row * width_ + slot(key, row)));
+    }
+    return frequency;
+  }
+
+ private:
+  /// @brief Counter position of a key in a row
+  /// @param key Flattened tile index
+  /// @param row Row
+  /// @return Counter position in the row
+  [[nodiscard]] size_t slot(size_t key, size_t row) const {
+    // splitmix64 finalizer, seeded per row
+    uint64_t hash = (uint64_t) key + 0x9E3779B97F4A7C15ULL * (row + 1);
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    hash ^= hash >> 31;
+    return (size_t) hash & (width_ - 1);
+  }
+
+  /// @brief Halve all the counters
+  void age() {
+    for (auto &counter : counters_) { counter = (uint8_t) (counter >> 1); }
+    nbIncrements_ /= 2;
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_FREQUENCY_SKETCH_H
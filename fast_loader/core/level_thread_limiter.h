@@ -0,0 +1,84 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+
+#ifndef FAST_LOADER_LEVEL_THREAD_LIMITER_H
+#define FAST_LOADER_LEVEL_THREAD_LIMITER_H
+
+#include <condition_variable>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Limit the number of threads of a task running at a time for each level and across the levels
+/// @details The level graph is duplicated for each level with the same number of threads per task. The threads past the
+/// limit of their level, or past the limit shared by the levels, wait before processing their data, so the levels do
+/// not oversubscribe the cores.
+class LevelThreadLimiter {
+ private:
+  std::vector<size_t> const limitPerLevel_{}; ///< Number of running threads per level, 0 for no limit
+  size_t const sharedLimit_ = 0; ///< Number of running threads across the levels, 0 for no limit
+  std::vector<size_t> nbRunningPerLevel_{}; ///< Number of running threads per level
+  size_t nbRunning_ = 0; ///< Number of running threads across the levels
+  std::mutex mutex_{}; ///< Limiter mutex
+  std::condition_variable cv_{}; ///< Condition variable notified when a thread stops running
+
+ public:
+  /// @brief Level thread limiter constructor
+  /// @param limitPerLevel Number of running threads per level, 0 for no limit
+  /// @param sharedLimit Number of running threads across the levels, 0 for no limit
+  LevelThreadLimiter(std::vector<size_t> limitPerLevel, size_t sharedLimit)
+      : limitPerLevel_(std::move(limitPerLevel)), sharedLimit_(sharedLimit),
+        nbRunningPerLevel_(limitPerLevel_.size(), 0) {}
+
+  /// @brief Default destructor
+  virtual ~LevelThreadLimiter() = default;
+
+  /// @brief Wait until a thread of a level can run
+  /// @param level Pyramidal level
+  void acquire(size_t level) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this, level]() {
+      return (limitPerLevel_.at(level) == 0 || nbRunningPerLevel_.at(level) < limitPerLevel_.at(level))
+          && (sharedLimit_ == 0 || nbRunning_ < sharedLimit_);
+    });
+    ++nbRunningPerLevel_.at(level);
+    ++nbRunning_;
+  }
+
+  /// @brief Notify a thread of a level stops running
+  /// @param level Pyramidal level
+  void release(size_t level) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --nbRunningPerLevel_.at(level);
+      --nbRunning_;
+    }
+    cv_.notify_all();
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_LEVEL_THREAD_LIMITER_H
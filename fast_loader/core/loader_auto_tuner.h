@@ -0,0 +1,169 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+
+#ifndef FAST_LOADER_LOADER_AUTO_TUNER_H
+#define FAST_LOADER_LOADER_AUTO_TUNER_H
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include "../api/data/loader_tuning_statistics.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Controller of the number of tile loader threads loading at a time, converging to the best throughput
+/// @details The threads past the number of active threads wait before loading (they are parked). At the end of every
+/// tuning period, the throughput of the period is compared to the previous one, hill climbing on the number of active
+/// threads: an increase is kept only if it raises the throughput, a decrease is kept as long as it does not lower it,
+/// else the direction is reversed. After a reversal, the number of active threads is held for HoldPeriods evaluated
+/// periods before probing again in the new direction, so the tuner settles around the best number of threads instead
+/// of changing it every period. The periods where the active threads have never all been loading at the same time are
+/// not evaluated, the loads are then limited by the requests and not by the storage. The tuner starts with all the
+/// threads active.
+class LoaderAutoTuner {
+ private:
+  static double constexpr Tolerance = 0.05; ///< Relative throughput change considered as noise
+  static size_t constexpr HoldPeriods = 8; ///< Evaluated periods the number of threads is held after a reversal
+
+  size_t const
+      minThreads_ = 1, ///< Minimum number of active threads
+      maxThreads_ = 1; ///< Maximum number of active threads
+  std::chrono::nanoseconds const period_{}; ///< Tuning period
+
+  size_t
+      nbActiveThreads_ = 1, ///< Number of threads allowed to load at a time
+      nbRunning_ = 0, ///< Number of threads loading
+      nbParked_ = 0, ///< Number of threads parked, waiting for an active slot to load
+      nbAdjustments_ = 0, ///< Number of changes of the number of active threads
+      nbHoldPeriods_ = 0, ///< Number of evaluated periods left before probing again after a reversal
+      nbLoadedPeriod_ = 0; ///< Number of tiles loaded during the period
+  long direction_ = -1; ///< Direction of the next change of the number of active threads
+  bool saturatedPeriod_ = false; ///< Set if all the active threads have loaded at the same time during the period
+  double
+      throughput_ = 0, ///< Throughput of the last evaluated period, in tiles per second
+      lastThroughput_ = 0; ///< Throughput before the last change
+  std::chrono::nanoseconds
+      loadTimePeriod_{}, ///< Loading time accumulated during the period
+      loadLatency_{}; ///< Mean loading time of the last evaluated period
+  std::chrono::steady_clock::time_point periodStart_ = std::chrono::steady_clock::now(); ///< Start of the period
+  std::mutex mutex_{}; ///< Tuner mutex
+  std::condition_variable cv_{}; ///< Condition variable notified when a thread can load
+
+ public:
+  /// @brief Loader auto-tuner constructor
+  /// @param minThreads Minimum number of active threads, at least 1
+  /// @param maxThreads Maximum number of active threads, at least minThreads
+  /// @param period Tuning period
+  LoaderAutoTuner(size_t minThreads, size_t maxThreads, std::chrono::nanoseconds period)
+      : minThreads_(std::max((size_t) 1, minThreads)), maxThreads_(std::max(minThreads_, maxThreads)),
+        period_(period), nbActiveThreads_(maxThreads_) {}
+
+  /// @brief Default destructor
+  virtual ~LoaderAutoTuner() = default;
+
+  /// @brief Statistics accessor
+  /// @return Tuning statistics
+  [[nodiscard]] LoaderTuningStatistics statistics() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return {nbActiveThreads_, nbParked_, nbAdjustments_, throughput_, loadLatency_};
+  }
+
+  /// @brief Wait until the thread can load
+  void acquire() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (nbRunning_ >= nbActiveThreads_) {
+      ++nbParked_;
+      cv_.wait(lock, [this]() { return nbRunning_ < nbActiveThreads_; });
+      --nbParked_;
+    }
+    if (++nbRunning_ == nbActiveThreads_) { saturatedPeriod_ = true; }
+  }
+
+  /// @brief Notify a thread has loaded a tile, and tune the number of active threads at the end of the period
+  /// @param loadTime Time taken to load the tile
+  void release(std::chrono::nanoseconds loadTime) { release(loadTime, std::chrono::steady_clock::now()); }
+
+  /// @brief Notify a thread has loaded a tile at a given time, and tune the number of active threads at the end of the
+  /// period
+  /// @param loadTime Time taken to load the tile
+  /// @param now Time of the end of the load
+  void release(std::chrono::nanoseconds loadTime, std::chrono::steady_clock::time_point const &now) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --nbRunning_;
+      ++nbLoadedPeriod_;
+      loadTimePeriod_ += loadTime;
+      if (now - periodStart_ >= period_) { tune(now); }
+    }
+    cv_.notify_all();
+  }
+
+ private:
+  /// @brief Evaluate the period and change the number of active threads, to call with the mutex locked
+  /// @param now End of the period
+  void tune(std::chrono::steady_clock::time_point const &now) {
+    auto const elapsed = std::chrono::duration<double>(now - periodStart_).count();
+    throughput_ = (double) nbLoadedPeriod_ / elapsed;
+    loadLatency_ = loadTimePeriod_ / nbLoadedPeriod_;
+    if (saturatedPeriod_ || nbParked_ > 0) {
+      if (nbHoldPeriods_ > 0) {
+        // The last held period is the reference of the probe
+        if (--nbHoldPeriods_ == 0) { step(); }
+      } else {
+        if (lastThroughput_ > 0) {
+          bool const reverse = direction_ > 0
+                               ? throughput_ < lastThroughput_ * (1 + Tolerance)
+                               : throughput_ < lastThroughput_ * (1 - Tolerance);
+          if (reverse) {
+            direction_ = -direction_;
+            nbHoldPeriods_ = HoldPeriods;
+          }
+        }
+        step();
+      }
+      lastThroughput_ = throughput_;
+    }
+    nbLoadedPeriod_ = 0;
+    loadTimePeriod_ = std::chrono::nanoseconds::zero();
+    saturatedPeriod_ = false;
+    periodStart_ = now;
+  }
+
+  /// @brief Change the number of active threads by one in the current direction, to call with the mutex locked
+  void step() {
+    if ((direction_ < 0 && nbActiveThreads_ == minThreads_) || (direction_ > 0 && nbActiveThreads_ == maxThreads_)) {
+      direction_ = -direction_;
+    }
+    auto const nbActiveThreads = std::clamp(
+        (size_t) ((long) nbActiveThreads_ + direction_), minThreads_, maxThreads_);
+    if (nbActiveThreads != nbActiveThreads_) {
+      nbActiveThreads_ = nbActiveThreads;
+      ++nbAdjustments_;
+    }
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_LOADER_AUTO_TUNER_H
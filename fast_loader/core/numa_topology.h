@@ -0,0 +1,171 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_NUMA_TOPOLOGY_H
+#define FAST_LOADER_NUMA_TOPOLOGY_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#ifdef __linux__
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif //__linux__
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief NUMA topology of the machine, used to home the cached tiles and the views and to place the threads
+/// @details The topology is read from /sys/devices/system/node on Linux, and the memory is bound with the mbind system
+/// call so libnuma is not needed at link time. On other systems, or if the topology can not be read, the machine is
+/// seen as a single node and all the operations are no-ops. The operations are hints: failures are ignored.
+class NumaTopology {
+ private:
+  std::vector<int> nodeIds_{}; ///< Ids of the nodes having CPUs
+  std::vector<std::vector<int>> cpusPerNode_{}; ///< CPUs per node
+  std::atomic<size_t> nextNode_{0}; ///< Next node used to place a thread, round-robin
+
+ public:
+  /// @brief Constructor detecting the topology of the machine
+  NumaTopology() {
+#ifdef __linux__
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string nodeList;
+    if (online && std::getline(online, nodeList)) {
+      for (auto nodeId : parseCpuList(nodeList)) {
+        std::ifstream cpuList("/sys/devices/system/node/node" + std::to_string(nodeId) + "/cpulist");
+        std::string cpus;
+        if (cpuList && std::getline(cpuList, cpus) && !parseCpuList(cpus).empty()) {
+          nodeIds_.push_back(nodeId);
+          cpusPerNode_.push_back(parseCpuList(cpus));
+        }
+      }
+    }
+#endif //__linux__
+    if (nodeIds_.empty()) {
+      nodeIds_ = {0};
+      cpusPerNode_ = {{}};
+    }
+  }
+
+  /// @brief Constructor from a given topology, the nodes ids are their positions
+  /// @param cpusPerNode CPUs per node
+  explicit NumaTopology(std::vector<std::vector<int>> cpusPerNode) : cpusPerNode_(std::move(cpusPerNode)) {
+    for (size_t node = 0; node < cpusPerNode_.size(); ++node) { nodeIds_.push_back((int) node); }
+    if (nodeIds_.empty()) {
+      nodeIds_ = {0};
+      cpusPerNode_ = {{}};
+    }
+  }
+
+  /// @brief Default destructor
+  virtual ~NumaTopology() = default;
+
+  /// @brief Number of nodes accessor
+  /// @return Number of nodes having CPUs, 1 if the topology is not available
+  [[nodiscard]] size_t nbNodes() const { return nodeIds_.size(); }
+
+  /// @brief CPUs of a node accessor
+  /// @param node Node position
+  /// @return CPUs of the node
+  [[nodiscard]] std::vector<int> const &cpus(size_t node) const { return cpusPerNode_.at(node); }
+
+  /// @brief Get the node of the CPU running the calling thread
+  /// @return Node position, 0 if not available
+  [[nodiscard]] size_t currentNode() const {
+#ifdef __linux__
+    int cpu = sched_getcpu();
+    for (size_t node = 0; node < cpusPerNode_.size(); ++node) {
+      auto const &nodeCpus = cpusPerNode_.at(node);
+      if (std::find(nodeCpus.cbegin(), nodeCpus.cend(), cpu) != nodeCpus.cend()) { return node; }
+    }
+#endif //__linux__
+    return 0;
+  }
+
+  /// @brief Pin the calling thread to the CPUs of the next node, round-robin
+  /// @return Node position the thread has been pinned to
+  size_t pinCurrentThread() {
+    size_t node = nextNode_++ % nbNodes();
+    pinCurrentThread(node);
+    return node;
+  }
+
+  /// @brief Pin the calling thread to the CPUs of a node, no-op on a single node
+  /// @param node Node position
+  void pinCurrentThread([[maybe_unused]] size_t node) const {
+#ifdef __linux__
+    if (nbNodes() < 2 || cpus(node).empty()) { return; }
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (auto cpu : cpus(node)) { CPU_SET(cpu, &cpuSet); }
+    sched_setaffinity(0, sizeof(cpu_set_t), &cpuSet);
+#endif //__linux__
+  }
+
+  /// @brief Home the pages fully covered by a buffer on a node, moving them if already touched, no-op on a single node
+  /// @param buffer Buffer
+  /// @param nbBytes Size of the buffer in bytes
+  /// @param node Node position
+  void bindMemory([[maybe_unused]] void *buffer, [[maybe_unused]] size_t nbBytes, [[maybe_unused]] size_t node) const {
+#if defined(__linux__) && defined(SYS_mbind)
+    if (nbNodes() < 2) { return; }
+    auto const pageSize = (uintptr_t) sysconf(_SC_PAGESIZE);
+    uintptr_t const
+        begin = (reinterpret_cast<uintptr_t>(buffer) + pageSize - 1) / pageSize * pageSize,
+        end = (reinterpret_cast<uintptr_t>(buffer) + nbBytes) / pageSize * pageSize;
+    if (begin >= end) { return; }
+    auto const nodeId = (size_t) nodeIds_.at(node), nbBitsPerMask = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> nodeMask(nodeId / nbBitsPerMask + 1, 0);
+    nodeMask.at(nodeId / nbBitsPerMask) |= 1UL << (nodeId % nbBitsPerMask);
+    int const preferredPolicy = 1, moveFlag = 1 << 1; // MPOL_PREFERRED, MPOL_MF_MOVE
+    syscall(SYS_mbind, begin, end - begin, preferredPolicy, nodeMask.data(), nodeMask.size() * nbBitsPerMask + 1,
+            moveFlag);
+#endif //defined(__linux__) && defined(SYS_mbind)
+  }
+
+  /// @brief Parse a list of CPUs or nodes as found in /sys, e.g. "0-3,8,10-11"
+  /// @param list List to parse
+  /// @return Parsed ids
+  static std::vector<int> parseCpuList(std::string const &list) {
+    std::vector<int> ids;
+    std::istringstream iss(list);
+    std::string range;
+    while (std::getline(iss, range, ',')) {
+      if (range.empty() || range.find_first_not_of(" \n") == std::string::npos) { continue; }
+      auto dash = range.find('-');
+      int const
+          first = std::stoi(range.substr(0, dash)),
+          last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+      for (int id = first; id <= last; ++id) { ids.push_back(id); }
+    }
+    return ids;
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_NUMA_TOPOLOGY_H
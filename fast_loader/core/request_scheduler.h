@@ -0,0 +1,180 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_REQUEST_SCHEDULER_H
+#define FAST_LOADER_REQUEST_SCHEDULER_H
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <vector>
+#include "../api/data/index_request.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Scheduler admitting the requests in the graph by priority
+/// @details The hedgehog queues are FIFO, so a request is only reordered while it waits in the scheduler: at most
+/// window requests are in the graph at a time, the other ones wait in a priority queue, highest priority first and in
+/// request order for the same priority. A request is out of the graph once its view has been sent by the ViewCounter.
+/// The preview request of a view is admitted with it, and does not count in the window as a preview can be discarded.
+/// The cancelled requests are dropped instead of being admitted.
+/// A stream of requests (e.g. all the views of a level) is submitted as a single entry generating its requests one at a
+/// time when admitted, so the waiting requests of a stream do not use any memory. Each time a request of a stream is
+/// admitted, the rest of the stream takes a new order, as if its next request was submitted at that time, so the
+/// requests of the same priority submitted meanwhile are interleaved with the stream instead of waiting for its end.
+class RequestScheduler {
+ public:
+  /// @brief Generator of the requests of a stream, giving the preview request if any then the view request, or nothing
+  /// once the stream is exhausted
+  using Generator = std::function<std::vector<std::shared_ptr<IndexRequest>>()>;
+
+ private:
+  /// @brief Requests waiting to be admitted
+  struct Entry {
+    int priority = 0; ///< Priority of the view request
+    size_t sequence = 0; ///< Request order, renewed each time a stream admits a request
+    std::vector<std::shared_ptr<IndexRequest>> requests{}; ///< Preview request if any, then the view request
+    Generator generator{}; ///< Generator of the requests for a stream, the requests are empty
+
+    /// @brief Order of the priority queue, the top is the highest priority, and the first requested for a same priority
+    /// @param rhs Entry to compare with
+    /// @return True if this entry should be admitted after rhs
+    bool operator<(Entry const &rhs) const {
+      return priority < rhs.priority || (priority == rhs.priority && sequence > rhs.sequence);
+    }
+  };
+
+  size_t const window_{}; ///< Maximum number of view requests in the graph
+  std::function<void(std::shared_ptr<IndexRequest> const &)> push_{}; ///< Push a request into the graph
+  std::function<void()> finish_{}; ///< Notify the graph no more requests will be pushed
+  std::priority_queue<Entry> waiting_{}; ///< Requests waiting to be admitted
+  size_t
+      nbInFlight_ = 0, ///< Number of view requests in the graph
+      sequence_ = 0; ///< Next request order
+  bool
+      finishing_ = false, ///< Set when no more requests will be submitted
+      finished_ = false; ///< Set once the graph has been notified
+  std::mutex mutex_{}; ///< Mutex protecting the scheduler
+
+ public:
+  /// @brief Request scheduler constructor
+  /// @param window Maximum number of view requests in the graph
+  /// @param push Function pushing a request into the graph
+  /// @param finish Function notifying the graph no more requests will be pushed
+  RequestScheduler(size_t window, std::function<void(std::shared_ptr<IndexRequest> const &)> push,
+                   std::function<void()> finish)
+      : window_(std::max((size_t) 1, window)), push_(std::move(push)), finish_(std::move(finish)) {}
+
+  /// @brief Default destructor
+  virtual ~RequestScheduler() = default;
+
+  /// @brief Number of waiting requests accessor
+  /// @return Number of view requests waiting to be admitted, a stream counts for one
+  [[nodiscard]] size_t nbWaiting() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return waiting_.size();
+  }
+
+  /// @brief Submit a view request, admitted in the graph right away if the window is not full
+  /// @param request View request, its priority is used
+  /// @param preview Preview request sent before the view request, nullptr for none [default nullptr]
+  void submit(std::shared_ptr<IndexRequest> const &request, std::shared_ptr<IndexRequest> const &preview = nullptr) {
+    Entry entry{request->priority_, 0, {}, {}};
+    if (preview) { entry.requests.push_back(preview); }
+    entry.requests.push_back(request);
+    std::lock_guard<std::mutex> lock(mutex_);
+    entry.sequence = sequence_++;
+    if (request->cancelled()) {
+      request->handle_->drop();
+    } else if (nbInFlight_ < window_) {
+      ++nbInFlight_;
+      admit(entry);
+    } else {
+      waiting_.push(std::move(entry));
+    }
+  }
+
+  /// @brief Submit a stream of view requests, its requests are generated when admitted, filling the window if not full
+  /// @param priority Priority of the view requests
+  /// @param generator Generator of the requests, called with the scheduler locked
+  void submit(int priority, Generator generator) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    waiting_.push(Entry{priority, sequence_++, {}, std::move(generator)});
+    while (nbInFlight_ < window_ && admitNext()) { ++nbInFlight_; }
+  }
+
+  /// @brief Notify a view has been sent, admit the next waiting request
+  void viewSent() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!admitNext()) { --nbInFlight_; }
+    finishIfDone();
+  }
+
+  /// @brief Notify no more requests will be submitted, the graph is notified once all the requests have been admitted
+  void finish() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    finishing_ = true;
+    finishIfDone();
+  }
+
+ private:
+  /// @brief Push the requests of an entry into the graph
+  /// @param entry Entry to admit
+  void admit(Entry const &entry) { for (auto const &request : entry.requests) { push_(request); }}
+
+  /// @brief Admit the next waiting view request, dropping the cancelled ones and the exhausted streams
+  /// @details A stream stays in the queue with its priority and order until exhausted.
+  /// @return True if a view request has been admitted, false if no request is waiting
+  bool admitNext() {
+    while (!waiting_.empty()) {
+      Entry entry = waiting_.top();
+      waiting_.pop();
+      if (entry.generator) {
+        auto requests = entry.generator();
+        if (requests.empty()) { continue; }
+        waiting_.push(Entry{entry.priority, sequence_++, {}, std::move(entry.generator)});
+        entry.requests = std::move(requests);
+      }
+      if (entry.requests.back()->cancelled()) {
+        entry.requests.back()->handle_->drop();
+      } else {
+        admit(entry);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// @brief Notify the graph if no more requests will be submitted and all of them have been admitted
+  void finishIfDone() {
+    if (finishing_ && !finished_ && waiting_.empty()) {
+      finished_ = true;
+      finish_();
+    }
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_REQUEST_SCHEDULER_H
@@ -0,0 +1,100 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+
+#ifndef FAST_LOADER_ALIAS_PHYSICAL_TO_VIEW_H
+#define FAST_LOADER_ALIAS_PHYSICAL_TO_VIEW_H
+
+#include <hedgehog/hedgehog.h>
+#include "../data/tile_request.h"
+#include "../data/cached_tile.h"
+#include "../data/view_data/tile_alias_view_data.h"
+#include "../../api/graph/options/abstract_border_creator.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Attach a physical cached tile to a TileAliasView instead of copying it
+/// @details The cached tile is read pinned by the view until it is recycled by the memory manager, then the semaphore
+/// acquired by the tile loader is released so the tile can be requested again while aliased. The aliases only read the
+/// cached tile: the padding of an edge tile is filled by the border creator once per load, by the first alias while the
+/// semaphore is held, before any other view can alias the tile.
+/// @tparam ViewType Type of the view
+template<class ViewType>
+class AliasPhysicalToView : public hh::AbstractTask<
+    1,
+    std::pair<std::shared_ptr<internal::TileRequest<ViewType>>,
+              std::shared_ptr<internal::CachedTile<typename ViewType::data_t>>>,
+    internal::TileRequest<ViewType>> {
+ private:
+  std::shared_ptr<AbstractBorderCreator<ViewType>> const
+      borderCreator_ = nullptr; ///< Border creator filling the padding of the edge tiles
+
+ public:
+  /// @brief Constructor for the alias task
+  /// @param borderCreator Border creator filling the padding of the edge tiles
+  explicit AliasPhysicalToView(std::shared_ptr<AbstractBorderCreator<ViewType>> borderCreator)
+      : hh::AbstractTask<
+      1,
+      std::pair<std::shared_ptr<internal::TileRequest<ViewType>>,
+                std::shared_ptr<internal::CachedTile<typename ViewType::data_t>>>,
+      internal::TileRequest<ViewType>>("Alias Physical To View"), borderCreator_(std::move(borderCreator)) {}
+
+  /// @brief Default destructor
+  ~AliasPhysicalToView() override = default;
+
+  /// @brief Set the cached tile as the view's data
+  /// @param data Pair containing the cached tile and the view
+  /// @throw std::runtime_error If the view's data can not alias a tile
+  void execute(std::shared_ptr<std::pair<std::shared_ptr<internal::TileRequest<ViewType>>,
+                                         std::shared_ptr<internal::CachedTile<typename ViewType::data_t>>>> data) override {
+    auto viewData = std::dynamic_pointer_cast<internal::TileAliasViewData<typename ViewType::data_t>>(
+        data->first->view()->viewData());
+    if (!viewData) {
+      throw std::runtime_error("Internal error: a cached tile can only be aliased by a TileAliasViewData");
+    }
+    // The request of the view has been cancelled, no tile has been loaded
+    if (data->second) {
+      viewData->alias(data->second);
+      if (!data->second->paddingFilled()) {
+        borderCreator_->fillBorderWithExistingValues(data->first->view());
+        data->second->paddingFilled(true);
+      }
+      data->second->releaseSemaphore();
+    }
+    this->addResult(data->first);
+  }
+
+  /// @brief Hedgehog copy method
+  /// @return New instance of the task doing the alias
+  std::shared_ptr<hh::AbstractTask<
+      1,
+      std::pair<std::shared_ptr<internal::TileRequest<ViewType>>,
+                std::shared_ptr<internal::CachedTile<typename ViewType::data_t>>>,
+      internal::TileRequest<ViewType>>> copy() override {
+    return std::make_shared<AliasPhysicalToView<ViewType>>(borderCreator_);
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_ALIAS_PHYSICAL_TO_VIEW_H
@@ -30,17 +30,25 @@ namespace fl {
 namespace internal {
 
 /// @brief Multi-threaded task to copy [parts of] logical caches to the view
+/// @details Receives the AdaptiveTileRequest directly if the logical tile is cached, or each piece copied from a
+/// physical tile (as a TileRequest) otherwise. In the latter case only the last piece, found with the countdown shared
+/// by the pieces, triggers the copy to the view.
 /// @tparam ViewType Type of the view
 template<class ViewType>
 class CopyLogicalTileToView :
-    public hh::AbstractTask<1, fl::internal::AdaptiveTileRequest<ViewType>, fl::internal::TileRequest<ViewType>> {
+    public hh::AbstractTask<2,
+                            fl::internal::AdaptiveTileRequest<ViewType>,
+                            fl::internal::TileRequest<ViewType>,
+                            fl::internal::TileRequest<ViewType>> {
   using DataType = typename ViewType::data_t; ///< Type of data inside a View
  public:
   /// @brief CopyLogicalCacheToView constructor
   /// @param nbThreads Number of thread associated to the task
   explicit CopyLogicalTileToView(size_t const nbThreads)
-      : hh::AbstractTask<1, fl::internal::AdaptiveTileRequest<ViewType>, fl::internal::TileRequest<ViewType>>(
-      "CopyLogicalTileToView", nbThreads) {}
+      : hh::AbstractTask<2,
+                         fl::internal::AdaptiveTileRequest<ViewType>,
+                         fl::internal::TileRequest<ViewType>,
+                         fl::internal::TileRequest<ViewType>>("CopyLogicalTileToView", nbThreads) {}
 
   /// @brief Default destructor
   virtual ~CopyLogicalTileToView() = default;
@@ -84,10 +92,23 @@ class CopyLogicalTileToView :
     logicalCachedTile->unlock(); // Unlock the tile after copying
   }
 
+  /// @brief Count a piece of a logical tile copied from a physical tile, copy the logical tile to the view when it
+  /// is the last one
+  /// @param tileRequest AdaptiveTileRequest piece under the form of a TileRequest
+  /// @throw std::runtime_error If the tile request is not an AdaptiveTileRequest
+  void execute(std::shared_ptr<fl::internal::TileRequest<ViewType>> tileRequest) override {
+    auto adaptiveTileRequest = std::dynamic_pointer_cast<fl::internal::AdaptiveTileRequest<ViewType>>(tileRequest);
+    if (adaptiveTileRequest == nullptr) {
+      throw std::runtime_error("The tile Request sent to a CopyLogicalTileToView should be an AdaptiveTileRequest");
+    }
+    if (adaptiveTileRequest->physicalTileRequestDone()) { execute(adaptiveTileRequest); }
+  }
+
   /// @brief Copy method to duplicate the Hedgehog tasks
   /// @return New Hedgehog task instance
-  std::shared_ptr<hh::AbstractTask<1,
+  std::shared_ptr<hh::AbstractTask<2,
                                    fl::internal::AdaptiveTileRequest<ViewType>,
+                                   fl::internal::TileRequest<ViewType>,
                                    fl::internal::TileRequest<ViewType>>> copy() override {
     return std::make_shared<CopyLogicalTileToView<ViewType>>(this->numberThreads());
   }
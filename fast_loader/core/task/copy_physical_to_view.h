@@ -22,6 +22,8 @@
 #include <hedgehog/hedgehog.h>
 #include "../data/tile_request.h"
 #include "../data/cached_tile.h"
+#include "../numa_topology.h"
+#include "../level_thread_limiter.h"
 
 /// @brief FastLoader namespace
 namespace fl {
@@ -37,20 +39,32 @@ class CopyPhysicalToView : public hh::AbstractTask<
     std::pair<std::shared_ptr<internal::TileRequest<ViewType>>,
               std::shared_ptr<internal::CachedTile<typename ViewType::data_t>>>,
     internal::TileRequest<ViewType>> {
+  std::shared_ptr<NumaTopology> numaTopology_ = nullptr; ///< NUMA topology used to place the threads, can be nullptr
+  std::shared_ptr<LevelThreadLimiter>
+      threadLimiter_ = nullptr; ///< Limiter of the threads copying per level, shared by copies, can be nullptr
 
  public:
   /// @brief Default constructor for the copy task
   /// @param numberThreads Number of threads associated to the task
-  explicit CopyPhysicalToView(size_t const numberThreads)
+  /// @param numaTopology NUMA topology used to place the threads, nullptr if not NUMA aware [default nullptr]
+  /// @param threadLimiter Limiter of the threads copying per level, nullptr for none [default nullptr]
+  explicit CopyPhysicalToView(size_t const numberThreads, std::shared_ptr<NumaTopology> numaTopology = nullptr,
+                              std::shared_ptr<LevelThreadLimiter> threadLimiter = nullptr)
       : hh::AbstractTask<
       1,
       std::pair<std::shared_ptr<internal::TileRequest<ViewType>>,
                 std::shared_ptr<internal::CachedTile<typename ViewType::data_t>>>,
-      internal::TileRequest<ViewType>>("Copy Physical To View", numberThreads, false) {}
+      internal::TileRequest<ViewType>>("Copy Physical To View", numberThreads, false),
+        numaTopology_(std::move(numaTopology)), threadLimiter_(std::move(threadLimiter)) {}
 
   /// @brief Default destructor
   ~CopyPhysicalToView() override = default;
 
+  /// @brief Pin the thread on a NUMA node if NUMA aware
+  void initialize() override {
+    if (numaTopology_) { numaTopology_->pinCurrentThread(); }
+  }
+
   /// @brief Do the actual copy between the cached tile and the view. If the copy covers the entirety of the the cached tile and the view the copy is direct
   /// @param data Pair containing the cached tile and the view
   void execute(std::shared_ptr<std::pair<std::shared_ptr<internal::TileRequest<ViewType>>,
@@ -58,8 +72,28 @@ class CopyPhysicalToView : public hh::AbstractTask<
     auto tileRequestData = data->first;
     auto cachedTile = data->second;
 
+    // The request of the view has been cancelled, or the tile loader has already copied the tile
+    if (!cachedTile) {
+      this->addResult(tileRequestData);
+      return;
+    }
+
     cachedTile->lock();
-    
+    // The slot is taken once the tile is held, so it is never held while waiting for a tile in use
+    if (threadLimiter_) { threadLimiter_->acquire(this->graphId()); }
+    copyTile(tileRequestData, cachedTile);
+    this->addResult(tileRequestData);
+    cachedTile->releaseSemaphore(); // Release the semaphore to allow other tasks to access the tile
+    cachedTile->unlock(); // Unlock the tile after copying
+    if (threadLimiter_) { threadLimiter_->release(this->graphId()); }
+  }
+
+  /// @brief Copy a locked cached tile to the view of a tile request
+  /// @details If the copy covers the entirety of the the cached tile and the view the copy is direct
+  /// @param tileRequestData Tile request
+  /// @param cachedTile Cached tile, locked
+  static void copyTile(std::shared_ptr<internal::TileRequest<ViewType>> const &tileRequestData,
+                       std::shared_ptr<internal::CachedTile<typename ViewType::data_t>> const &cachedTile) {
     typename ViewType::data_t
         *const dataFrom = cachedTile->data()->data(),
         *const dataTo = tileRequestData->view()->viewOrigin();
@@ -86,10 +120,6 @@ class CopyPhysicalToView : public hh::AbstractTask<
         copyImpl(dataFrom, dataTo, dimensionFrom, dimensionTo, 0, 0, copy, dimensionFrom.size());
       }
     }
-    
-    this->addResult(tileRequestData);
-    cachedTile->releaseSemaphore(); // Release the semaphore to allow other tasks to access the tile
-    cachedTile->unlock(); // Unlock the tile after copying
   }
 
   /// @brief Hedgehog copy method
@@ -99,7 +129,8 @@ class CopyPhysicalToView : public hh::AbstractTask<
       std::pair<std::shared_ptr<internal::TileRequest<ViewType>>,
                 std::shared_ptr<internal::CachedTile<typename ViewType::data_t>>>,
       internal::TileRequest<ViewType>>> copy() override {
-    return std::make_shared<CopyPhysicalToView<ViewType>>(this->numberThreads());
+    return std::make_shared<CopyPhysicalToView<ViewType>>(
+        this->numberThreads(), numaTopology_, threadLimiter_);
   }
 
  private:
@@ -114,12 +145,12 @@ class CopyPhysicalToView : public hh::AbstractTask<
   /// @param copy Copy description
   /// @param nbDimension Number of dimensions
   /// @param dimension Current visited dimension
-  inline void copyImpl(
+  static inline void copyImpl(
       typename ViewType::data_t *from, typename ViewType::data_t *to,
       std::vector<size_t> const &dimensionFrom, std::vector<size_t> const &dimensionTo,
       size_t deltaFrom, size_t deltaTo,
       internal::CopyVolume const &copy,
-      size_t const nbDimension, size_t const dimension = 0) const {
+      size_t const nbDimension, size_t const dimension = 0) {
 
     if (dimension == nbDimension - 1) {
       // If copy is reversed for the most inner dimension use revers_copy instead of copy
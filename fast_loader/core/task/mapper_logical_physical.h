@@ -20,6 +20,8 @@
 #define FAST_LOADER_MAPPER_LOGICAL_PHYSICAL_H
 
 #include <utility>
+#include <map>
+#include <numeric>
 #include <hedgehog/hedgehog.h>
 
 #include "../data/adaptive_tile_request.h"
@@ -45,8 +47,16 @@ class MapperLogicalPhysical : public hh::AbstractTask<1, TileRequest<ViewType>,
   fullDimensionPerLevel_{}; ///< Dimension of the file
 
 
+  /// @brief Copy from a physical tile, the physical tile index is relative to the first physical tile overlapping the
+  /// logical tile
+  using PhysicalCopy = std::pair<std::vector<size_t>, CopyVolume>;
+
   std::vector<std::vector<size_t>>
-      nbLogicalTilesPerDimensionPerLevel_{}; ///< Number of logical tiles per dimension per level
+      nbLogicalTilesPerDimensionPerLevel_{}, ///< Number of logical tiles per dimension per level
+      periodPerLevel_{}; ///< Number of logical tiles after which the copy geometry repeats, per dimension per level
+
+  std::vector<std::map<std::vector<size_t>, std::vector<PhysicalCopy>>>
+      copyPlansPerLevel_{}; ///< Memoized copy plans per residue class per level
 
   std::shared_ptr<std::vector<std::shared_ptr<internal::Cache<typename ViewType::data_t>>>> const
       logicalTileCaches_; ///< All shared logical tile caches
@@ -56,12 +66,18 @@ class MapperLogicalPhysical : public hh::AbstractTask<1, TileRequest<ViewType>,
   std::shared_ptr<internal::Cache<DataType>>
       cache_{}; ///< Logical tile Cache
 
+  std::shared_ptr<TileRequestPool> const
+      tileRequestPool_ = std::make_shared<TileRequestPool>(); ///< Pool the adaptive tile requests are allocated from
+
+  std::vector<size_t> requestedIndex_{}; ///< Index of the requested logical tile, reused by the requests
+
   size_t
       nbElementDirectToCopy_ = 0, ///< Counter of number AdaptiveTileRequest that have a cached tile ready
   nbElementsToTL_ = 0; ///< Counter of number AdaptiveTileRequest that have an empty tile ready
 
  public:
-  /// @brief Mapper constructor, compute the number of logical tiles per dimension per level
+  /// @brief Mapper constructor, compute the number of logical tiles per dimension per level and the period of the copy
+  /// plans
   /// @param physicalTileDimensionPerLevel Physical tile dimension per level
   /// @param logicalTileDimensionPerLevel Logical tile dimension per level
   /// @param fullDimensionPerLevel Full dimension per level
@@ -89,7 +105,17 @@ class MapperLogicalPhysical : public hh::AbstractTask<1, TileRequest<ViewType>,
             return (size_t) ceil((double) (fullDimension) / (double) (logicalTileDimension));
           }
       );
+      periodPerLevel_.emplace_back();
+      std::transform(
+          logicalTileDimensionPerLevel_->at(level).cbegin(), logicalTileDimensionPerLevel_->at(level).cend(),
+          physicalTileDimensionPerLevel_->at(level).cbegin(),
+          std::back_insert_iterator<std::vector<size_t>>(periodPerLevel_.at(level)),
+          [](auto const &logicalTileDimension, auto const &physicalTileDimension) {
+            return std::lcm(logicalTileDimension, physicalTileDimension) / logicalTileDimension;
+          }
+      );
     }
+    copyPlansPerLevel_.resize(physicalTileDimensionPerLevel_->size());
   }
 
   /// @brief Default destructor
@@ -104,96 +130,58 @@ class MapperLogicalPhysical : public hh::AbstractTask<1, TileRequest<ViewType>,
   void execute(std::shared_ptr<TileRequest<ViewType>> tileRequest) override {
     auto const &level = tileRequest->view()->level();
     auto const &nbDimensions = tileRequest->view()->nbDims();
-    auto const &requestedIndex = tileRequest->index();
+    requestedIndex_.assign(tileRequest->index().cbegin(), tileRequest->index().cend());
+    auto const &requestedIndex = requestedIndex_;
+    bool const noCache = tileRequest->view()->viewData()->noCache();
 
-    std::shared_ptr<CachedTile<DataType>> logicalCachedTile = cache_->lockedTile(requestedIndex);
+    std::shared_ptr<CachedTile<DataType>> logicalCachedTile = cache_->lockedTile(requestedIndex, noCache);
     logicalCachedTile->lock();
     if (!logicalCachedTile->newTile()) {
       ++nbElementDirectToCopy_;
       logicalCachedTile->unlock();
-      this->addResult(std::make_shared<fl::internal::AdaptiveTileRequest<ViewType>>(tileRequest, logicalCachedTile));
+      this->addResult(tileRequestPool_->make<AdaptiveTileRequest<ViewType>>(tileRequest, logicalCachedTile));
     } else {
       //Need to create N AdaptiveTileRequest to fill the logical Cache Tile from tile loader
-      std::vector<std::shared_ptr<fl::internal::AdaptiveTileRequest<ViewType>>> adaptiveTileRequests{};
+      logicalCachedTile->newTile(false);
 
+      std::vector<PhysicalCopy> const &copyPlan = this->copyPlan(level, requestedIndex);
       std::vector<size_t> const &
           logicalTileDimension = logicalTileDimensionPerLevel_->at(level),
           physicalTileDimension = physicalTileDimensionPerLevel_->at(level);
 
-      std::vector<size_t>
-          minPos, maxPos,
-          nbPhysicalTilePerDimension, nbLogicalTilePerDimension,
-          indexMinPhysical, indexMaxPhysical,
-          positionCopyFrom(nbDimensions, 0),
-          positionCopyTo(nbDimensions, 0),
-          dimensionCopy(nbDimensions, 0),
-          indexPhysicalTile(nbDimensions, 0);
-
-      std::size_t logicalTileId;
-
-      logicalCachedTile->newTile(false);
-
-      std::transform(
-          requestedIndex.cbegin(), requestedIndex.cend(), logicalTileDimension.cbegin(),
-          std::back_insert_iterator<std::vector<size_t>>(minPos),
-          [](auto const &i, auto const &tileDimension) { return i * tileDimension; });
-
-      std::transform(
-          fullDimensionPerLevel_->at(level).cbegin(),
-          fullDimensionPerLevel_->at(level).cend(),
-          physicalTileDimension.cbegin(),
-          std::back_insert_iterator<std::vector<size_t>>(nbPhysicalTilePerDimension),
-          [](auto const &fullDimension, auto const &physicalDimension) {
-            return (size_t) ceil((double) (fullDimension) / (double) physicalDimension);
-          }
-      );
-
-      std::transform(
-          fullDimensionPerLevel_->at(level).cbegin(),
-          fullDimensionPerLevel_->at(level).cend(),
-          logicalTileDimension.cbegin(),
-          std::back_insert_iterator<std::vector<size_t>>(nbLogicalTilePerDimension),
-          [](auto const &fullDimension, auto const &logicalDimension) {
-            return (size_t) ceil((double) (fullDimension) / (double) logicalDimension);
-          }
-      );
-
-      // index min physical  = min pos / physical dimension
-      std::transform(
-          minPos.cbegin(), minPos.cend(), physicalTileDimension.cbegin(),
-          std::back_insert_iterator<std::vector<size_t>>(indexMinPhysical),
-          [](auto const &pos, auto const &physicalDimension) { return pos / physicalDimension; });
-
+      // Index of the first physical tile overlapping the logical tile, used to rebase the plan
+      std::vector<size_t> indexMinPhysical(nbDimensions), indexPhysicalTile(nbDimensions);
       for (size_t dimension = 0; dimension < nbDimensions; ++dimension) {
-        maxPos.push_back(
-            std::min(
-                (requestedIndex.at(dimension) + 1) * logicalTileDimension.at(dimension),
-                fullDimensionPerLevel_->at(level).at(dimension))
-        );
-        indexMaxPhysical.push_back(
-            std::min(
-                (std::size_t) std::ceil((double) maxPos.at(dimension) / (double) physicalTileDimension.at(dimension)),
-                nbPhysicalTilePerDimension.at(dimension))
-        );
+        indexMinPhysical.at(dimension) =
+            requestedIndex.at(dimension) * logicalTileDimension.at(dimension) / physicalTileDimension.at(dimension);
       }
 
-      logicalTileId = computeLogicalTileId(requestedIndex, nbLogicalTilePerDimension);
-
-      createCopies(
-          logicalTileId, level, logicalCachedTile->data()->data(), fullDimensionPerLevel_->at(level),
-          indexMinPhysical, indexMaxPhysical,
-          nbLogicalTilePerDimension, requestedIndex,
-          tileRequest, logicalCachedTile, physicalTileDimension, logicalTileDimension,
-          minPos, maxPos, positionCopyFrom, positionCopyTo, dimensionCopy,
-          indexPhysicalTile, adaptiveTileRequests, nbDimensions
-      );
-
-      size_t const nbOfAdaptiveTileRequests = adaptiveTileRequests.size();
-      
-      for (auto &tr : adaptiveTileRequests) {
+      // All the physical pieces fill the same logical tile, they share the same view
+      auto adaptiveViewData = std::make_shared<AdaptiveViewData<DataType>>(logicalCachedTile->data()->data());
+      adaptiveViewData->initialize(fullDimensionPerLevel_->at(level),
+                                   logicalTileDimension,
+                                   std::vector<size_t>(nbDimensions, 0),
+                                   requestedIndex,
+                                   nbLogicalTilesPerDimensionPerLevel_.at(level),
+                                   dimensionNames_,
+                                   FillingType::CONSTANT,
+                                   level);
+      // The physical tiles are loaded with the no cache hint of the view
+      adaptiveViewData->noCache(noCache);
+      auto adaptiveView = std::make_shared<AdaptiveView<ViewType>>(adaptiveViewData);
+
+      // Countdown shared by the pieces, the last one copied forwards the logical tile to the view
+      auto remainingPhysicalTileRequests = std::make_shared<std::atomic<size_t>>(copyPlan.size());
+
+      for (auto const &[physicalOffset, copy] : copyPlan) {
+        std::transform(indexMinPhysical.cbegin(), indexMinPhysical.cend(), physicalOffset.cbegin(),
+                       indexPhysicalTile.begin(), std::plus<>());
+        auto adaptiveTileRequest = tileRequestPool_->make<AdaptiveTileRequest<ViewType>>(
+            indexPhysicalTile, adaptiveView, tileRequest, logicalCachedTile);
+        adaptiveTileRequest->addCopy(copy);
+        adaptiveTileRequest->remainingPhysicalTileRequests(remainingPhysicalTileRequests);
         ++nbElementsToTL_;
-        tr->nbPhysicalTileRequests(nbOfAdaptiveTileRequests);
-        this->addResult(tr);
+        this->addResult(adaptiveTileRequest);
       }
       logicalCachedTile->unlock();
     }
@@ -219,63 +207,87 @@ class MapperLogicalPhysical : public hh::AbstractTask<1, TileRequest<ViewType>,
   }
 
  private:
-  /// @brief Compute unique logical Id, used as key to map the logicalTile in the TileLoaderCounterState
-  /// @param requestedIndex Tile index
-  /// @param nbLogicalTilePerDimension Number of tiles per dimension
-  /// @param dimension Current dimension
-  /// @return Unique logical tile id
-  inline size_t computeLogicalTileId(
-      std::vector<size_t> const &requestedIndex,
-      std::vector<size_t> const &nbLogicalTilePerDimension,
-      size_t dimension = 0) {
-    if (dimension == requestedIndex.size() - 1) { return requestedIndex.at(dimension); }
-    else {
-      return
-          requestedIndex.at(dimension)
-              * std::accumulate(nbLogicalTilePerDimension.cbegin() + (long) dimension + 1,
-                                nbLogicalTilePerDimension.cend(), (size_t) 1, std::multiplies<>())
-              + computeLogicalTileId(requestedIndex, nbLogicalTilePerDimension, dimension + 1);
+  /// @brief Get the copy plan filling a logical tile from the physical tiles, built once per residue class
+  /// @details The geometry of the copies only depends on the logical index modulo the period (least common multiple of
+  /// the logical and physical tile dimensions divided by the logical tile dimension), except for the last logical tile
+  /// of a dimension that can be clipped by the file, which has its own class.
+  /// @param level Pyramidal level
+  /// @param requestedIndex Logical tile index
+  /// @return Copy plan, physical tile indexes relative to the first physical tile overlapping the logical tile
+  std::vector<PhysicalCopy> const &copyPlan(size_t const level, std::vector<size_t> const &requestedIndex) {
+    auto const &period = periodPerLevel_.at(level);
+    auto const &nbLogicalTilesPerDimension = nbLogicalTilesPerDimensionPerLevel_.at(level);
+    std::vector<size_t> residue(requestedIndex.size());
+    for (size_t dimension = 0; dimension < requestedIndex.size(); ++dimension) {
+      residue.at(dimension) = requestedIndex.at(dimension) == nbLogicalTilesPerDimension.at(dimension) - 1
+                              ? period.at(dimension) : requestedIndex.at(dimension) % period.at(dimension);
+    }
+    auto &copyPlans = copyPlansPerLevel_.at(level);
+    auto copyPlan = copyPlans.find(residue);
+    if (copyPlan == copyPlans.end()) {
+      copyPlan = copyPlans.emplace(residue, createCopyPlan(level, requestedIndex)).first;
     }
+    return copyPlan->second;
+  }
+
+  /// @brief Create the copy plan filling a logical tile from the physical tiles
+  /// @param level Pyramidal level
+  /// @param requestedIndex Logical tile index
+  /// @return Copy plan, physical tile indexes relative to the first physical tile overlapping the logical tile
+  std::vector<PhysicalCopy> createCopyPlan(size_t const level, std::vector<size_t> const &requestedIndex) const {
+    size_t const nbDimensions = requestedIndex.size();
+    std::vector<size_t> const &
+        logicalTileDimension = logicalTileDimensionPerLevel_->at(level),
+        physicalTileDimension = physicalTileDimensionPerLevel_->at(level),
+        fullDimension = fullDimensionPerLevel_->at(level);
+
+    std::vector<size_t>
+        minPos(nbDimensions), maxPos(nbDimensions),
+        indexMinPhysical(nbDimensions), indexMaxPhysical(nbDimensions),
+        positionCopyFrom(nbDimensions, 0),
+        positionCopyTo(nbDimensions, 0),
+        dimensionCopy(nbDimensions, 0),
+        indexPhysicalTile(nbDimensions, 0);
+
+    for (size_t dimension = 0; dimension < nbDimensions; ++dimension) {
+      minPos.at(dimension) = requestedIndex.at(dimension) * logicalTileDimension.at(dimension);
+      maxPos.at(dimension) = std::min(
+          (requestedIndex.at(dimension) + 1) * logicalTileDimension.at(dimension), fullDimension.at(dimension));
+      indexMinPhysical.at(dimension) = minPos.at(dimension) / physicalTileDimension.at(dimension);
+      indexMaxPhysical.at(dimension) =
+          (size_t) std::ceil((double) maxPos.at(dimension) / (double) physicalTileDimension.at(dimension));
+    }
+
+    std::vector<PhysicalCopy> copyPlan{};
+    createCopies(indexMinPhysical, indexMaxPhysical, physicalTileDimension, minPos, maxPos,
+                 positionCopyFrom, positionCopyTo, dimensionCopy, indexPhysicalTile, copyPlan, nbDimensions);
+    return copyPlan;
   }
 
   /// @brief Create copies to fill logical from physical tiles
-  /// @param id Logical tile id
-  /// @param level Current pyramidal level
-  /// @param dataOrigin  Pointer to the origin buffer
-  /// @param fullDimension Full / file dimensions
   /// @param indexMinPhysical Minimum index physical tile
   /// @param indexMaxPhysical Maximum index physical tile
-  /// @param nbLogicalTilesPerDimension Number of logical tiles per dimension
-  /// @param requestedIndex Requested index
-  /// @param tileRequest Tile request
-  /// @param logicalCachedTile Logical cached tile
   /// @param physicalTileDimension Physical tile dimensions
-  /// @param logicalTileDimension Logical tile dimensions
   /// @param minPos Source minimum position
   /// @param maxPos Source maximum position
   /// @param positionCopyFrom Source copy position
   /// @param positionCopyTo Destination copy position
   /// @param dimensionCopy Copy dimensions
-  /// @param indexPhysicalTile Index physical tile
-  /// @param adaptiveTileRequests Vector of adaptive tile requests
+  /// @param indexPhysicalTile Index physical tile, relative to indexMinPhysical
+  /// @param copyPlan Resulting copy plan
   /// @param nbDimensions Total number of dimensions
   /// @param dimension Current dimension
   inline void createCopies(
-      size_t const &id, size_t const &level, DataType *const dataOrigin, std::vector<size_t> const &fullDimension,
       std::vector<size_t> const &indexMinPhysical, std::vector<size_t> const &indexMaxPhysical,
-      std::vector<size_t> const &nbLogicalTilesPerDimension,
-      std::vector<size_t> const &requestedIndex, std::shared_ptr<TileRequest<ViewType>> const tileRequest,
-      std::shared_ptr<CachedTile<DataType>> const logicalCachedTile,
-      std::vector<size_t> const &physicalTileDimension, std::vector<size_t> const &logicalTileDimension,
+      std::vector<size_t> const &physicalTileDimension,
       std::vector<size_t> const &minPos, std::vector<size_t> const &maxPos,
       std::vector<size_t> &positionCopyFrom, std::vector<size_t> &positionCopyTo, std::vector<size_t> &dimensionCopy,
-      std::vector<size_t> &indexPhysicalTile,
-      std::vector<std::shared_ptr<fl::internal::AdaptiveTileRequest<ViewType>>> &adaptiveTileRequests,
-      size_t const nbDimensions, size_t const dimension = 0) {
+      std::vector<size_t> &indexPhysicalTile, std::vector<PhysicalCopy> &copyPlan,
+      size_t const nbDimensions, size_t const dimension = 0) const {
 
     positionCopyTo.at(dimension) = 0;
     for (size_t i = indexMinPhysical.at(dimension); i < indexMaxPhysical.at(dimension); ++i) {
-      indexPhysicalTile.at(dimension) = i;
+      indexPhysicalTile.at(dimension) = i - indexMinPhysical.at(dimension);
       // absolute pos copy from = max(index * physical dimension, minRow)
       positionCopyFrom.at(dimension) =
           std::max(size_t(i * physicalTileDimension.at(dimension)), minPos.at(dimension));
@@ -289,36 +301,13 @@ class MapperLogicalPhysical : public hh::AbstractTask<1, TileRequest<ViewType>,
       positionCopyFrom.at(dimension) -= i * physicalTileDimension.at(dimension);
 
       if (dimension == nbDimensions - 1) {
-        // If last dimension
-        // Create a view data that uses the cached logical data as internal data
-        auto adaptiveViewData = std::make_shared<AdaptiveViewData<DataType>>(dataOrigin);
-        // Describe the view data
-        adaptiveViewData->initialize(fullDimension,
-                                     logicalTileDimension,
-                                     std::vector<size_t>(nbDimensions, 0),
-                                     requestedIndex,
-                                     nbLogicalTilesPerDimension,
-                                     dimensionNames_,
-                                     FillingType::CONSTANT,
-                                     level);
-
-        // Create the view from the view data
-        auto adaptiveView = std::make_shared<AdaptiveView<ViewType>>(adaptiveViewData);
-
-        // Create an AdaptiveTileRequest with this view
-        auto adaptiveTileRequest = std::make_shared<AdaptiveTileRequest<ViewType>>(
-            indexPhysicalTile, adaptiveView, tileRequest, logicalCachedTile);
-        adaptiveTileRequest->addCopy(CopyVolume(positionCopyFrom, positionCopyTo, dimensionCopy));
-        adaptiveTileRequest->id(id);
-        adaptiveTileRequests.push_back(adaptiveTileRequest);
-
+        // If last dimension, register the copy from this physical tile
+        copyPlan.emplace_back(indexPhysicalTile, CopyVolume(positionCopyFrom, positionCopyTo, dimensionCopy));
       } else {
         // If not last dimension, go to the next
         createCopies(
-            id, level, dataOrigin, fullDimension, indexMinPhysical, indexMaxPhysical, nbLogicalTilesPerDimension,
-            requestedIndex, tileRequest, logicalCachedTile, physicalTileDimension, logicalTileDimension,
-            minPos, maxPos, positionCopyFrom, positionCopyTo, dimensionCopy, indexPhysicalTile, adaptiveTileRequests,
-            nbDimensions, dimension + 1
+            indexMinPhysical, indexMaxPhysical, physicalTileDimension, minPos, maxPos,
+            positionCopyFrom, positionCopyTo, dimensionCopy, indexPhysicalTile, copyPlan, nbDimensions, dimension + 1
         );
       }
       positionCopyTo.at(dimension) += dimensionCopy.at(dimension);
@@ -0,0 +1,172 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_PREVIEW_BUILDER_H
+#define FAST_LOADER_PREVIEW_BUILDER_H
+
+#include <hedgehog/hedgehog.h>
+#include "../cache.h"
+#include "../data/tile_request.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Task building the previews of the progressive mode, the other views are forwarded to the ViewLoader
+/// @details A preview is upsampled (nearest neighbour) from the first coarser level which has all the needed tiles in
+/// its cache and not in use. The cache is never waited on nor filled by a preview, if no coarser level is available the
+/// preview is dropped and only the full resolution view is sent.
+/// @tparam ViewType Type of the view
+/// @tparam ViewDataType View data type
+template<class ViewType, class ViewDataType>
+class PreviewBuilder : public hh::AbstractTask<1, ViewDataType, ViewDataType, TileRequest<ViewType>> {
+ private:
+  using DataType = typename ViewType::data_t; ///< Sample type
+  std::shared_ptr<std::vector<std::shared_ptr<Cache<DataType>>>> const caches_{}; ///< Caches for all pyramid levels
+
+  std::shared_ptr<std::vector<std::vector<size_t>>> const
+      fullDimensionPerLevel_{}, ///< Full / file dimensions per level
+      tileDimensionPerLevel_{}; ///< Tile dimensions per level
+
+  std::shared_ptr<TileRequestPool> const
+      tileRequestPool_ = std::make_shared<TileRequestPool>(); ///< Pool the tile requests are allocated from
+
+ public:
+  /// @brief PreviewBuilder constructor
+  /// @param caches Caches for all pyramid levels
+  /// @param fullDimensionPerLevel Full / file dimensions per level
+  /// @param tileDimensionPerLevel Tile dimensions per level
+  PreviewBuilder(std::shared_ptr<std::vector<std::shared_ptr<Cache<DataType>>>> const &caches,
+                 std::shared_ptr<std::vector<std::vector<size_t>>> const &fullDimensionPerLevel,
+                 std::shared_ptr<std::vector<std::vector<size_t>>> const &tileDimensionPerLevel)
+      : hh::AbstractTask<1, ViewDataType, ViewDataType, TileRequest<ViewType>>("Preview Builder"),
+        caches_(caches), fullDimensionPerLevel_(fullDimensionPerLevel), tileDimensionPerLevel_(tileDimensionPerLevel) {}
+
+  /// @brief Default destructor
+  ~PreviewBuilder() override = default;
+
+  /// @brief Build a preview, or forward the view data to the ViewLoader if it is not a preview
+  /// @details A built preview is sent as a single TileRequest without copies, directly ready for the ViewCounter
+  /// @param viewData View data to manage
+  void execute(std::shared_ptr<ViewDataType> viewData) override {
+    if (!viewData->isPreview()) {
+      this->addResult(viewData);
+      return;
+    }
+    for (size_t coarseLevel = viewData->level() + 1; coarseLevel < caches_->size(); ++coarseLevel) {
+      if (upsampleFromLevel(*viewData, coarseLevel)) {
+        auto view = std::make_shared<ViewType>();
+        view->viewData(viewData);
+        viewData->nbTilesToLoad(1);
+        this->addResult(tileRequestPool_->make<TileRequest<ViewType>>(viewData->indexCentralTile(), view));
+        return;
+      }
+    }
+    viewData->discard();
+  }
+
+  /// @brief Copy method for duplicating this Hedgehog task
+  /// @return New instance of this task
+  std::shared_ptr<hh::AbstractTask<1, ViewDataType, ViewDataType, TileRequest<ViewType>>> copy() override {
+    return std::make_shared<PreviewBuilder>(caches_, fullDimensionPerLevel_, tileDimensionPerLevel_);
+  }
+
+ private:
+  /// @brief Fill the view's data part with the upsampled data of a coarser level, if all its tiles are available
+  /// @param viewData View data to fill
+  /// @param coarseLevel Coarser level to upsample
+  /// @return True if the view data has been filled, else false
+  bool upsampleFromLevel(ViewDataType &viewData, size_t coarseLevel) {
+    auto const &cache = caches_->at(coarseLevel);
+    auto const &fullDimension = viewData.fullDims();
+    auto const &coarseFullDimension = fullDimensionPerLevel_->at(coarseLevel);
+    auto const &coarseTileDimension = tileDimensionPerLevel_->at(coarseLevel);
+    size_t const nbDimensions = viewData.nbDims();
+
+    auto coarsePosition = [&](size_t position, size_t dim) {
+      return position * coarseFullDimension.at(dim) / fullDimension.at(dim);
+    };
+
+    std::vector<size_t> minTileIndex(nbDimensions), maxTileIndex(nbDimensions);
+    for (size_t dim = 0; dim < nbDimensions; ++dim) {
+      minTileIndex.at(dim) = coarsePosition(viewData.minPos().at(dim), dim) / coarseTileDimension.at(dim);
+      maxTileIndex.at(dim) = coarsePosition(viewData.maxPos().at(dim) - 1, dim) / coarseTileDimension.at(dim) + 1;
+    }
+
+    // Lock all the tiles needed, or none
+    std::vector<std::shared_ptr<CachedTile<DataType>>> tiles{};
+    std::vector<size_t> tileIndex(minTileIndex);
+    do {
+      auto tile = cache->tryLockedTile(tileIndex);
+      if (!tile) { break; }
+      tiles.push_back(tile);
+    } while (nextPosition(tileIndex, minTileIndex, maxTileIndex));
+
+    bool const available =
+        tiles.size() == std::inner_product(
+            maxTileIndex.cbegin(), maxTileIndex.cend(), minTileIndex.cbegin(), (size_t) 1,
+            std::multiplies<>(), std::minus<>());
+
+    if (available) {
+      std::vector<size_t>
+          position(viewData.minPos()),
+          tileStride(nbDimensions, 1),
+          elementStride(nbDimensions, 1),
+          viewStride(nbDimensions, 1);
+      for (size_t dim = nbDimensions - 1; dim > 0; --dim) {
+        tileStride.at(dim - 1) = tileStride.at(dim) * (maxTileIndex.at(dim) - minTileIndex.at(dim));
+        elementStride.at(dim - 1) = elementStride.at(dim) * coarseTileDimension.at(dim);
+        viewStride.at(dim - 1) = viewStride.at(dim) * viewData.viewDims().at(dim);
+      }
+      DataType *data = viewData.data();
+      do {
+        size_t tilePos = 0, elementPos = 0, viewPos = 0;
+        for (size_t dim = 0; dim < nbDimensions; ++dim) {
+          size_t const coarse = coarsePosition(position.at(dim), dim);
+          tilePos += (coarse / coarseTileDimension.at(dim) - minTileIndex.at(dim)) * tileStride.at(dim);
+          elementPos += (coarse % coarseTileDimension.at(dim)) * elementStride.at(dim);
+          viewPos += (viewData.frontFill().at(dim) + position.at(dim) - viewData.minPos().at(dim)) * viewStride.at(dim);
+        }
+        data[viewPos] = tiles.at(tilePos)->data()->at(elementPos);
+      } while (nextPosition(position, viewData.minPos(), viewData.maxPos()));
+    }
+
+    for (auto &tile : tiles) { tile->releaseSemaphore(); }
+    return available;
+  }
+
+  /// @brief Go to the next position in a box, in row-major order
+  /// @param position Current position, updated
+  /// @param begin Box front
+  /// @param end Box back (excluded)
+  /// @return False if the position was the last one of the box
+  static bool nextPosition(std::vector<size_t> &position, std::vector<size_t> const &begin,
+                           std::vector<size_t> const &end) {
+    for (size_t dim = position.size(); dim > 0; --dim) {
+      if (++position.at(dim - 1) < end.at(dim - 1)) { return true; }
+      position.at(dim - 1) = begin.at(dim - 1);
+    }
+    return false;
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_PREVIEW_BUILDER_H
@@ -0,0 +1,114 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_VIEW_BATCHER_H
+#define FAST_LOADER_VIEW_BATCHER_H
+
+#include <hedgehog/hedgehog.h>
+#include <list>
+#include "../batch_allocator.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Task holding the finished BatchedViews until their batch is complete, and sending the batch's views in a row
+/// ordered by slot
+/// @details A batch is complete when it is sealed and all its views have been received. The timeout is tested when a
+/// view is received, the remaining batches are sealed and sent when no more views will be received.
+/// @tparam ViewType Type of the view
+template<class ViewType>
+class ViewBatcher : public hh::AbstractTask<1, ViewType, ViewType> {
+ private:
+  using Batch_t = std::shared_ptr<BatchBuffer<typename ViewType::data_t>>; ///< Helper to define the batch type
+  /// @brief Views received for a batch, stored by slot
+  struct PendingBatch {
+    Batch_t batch{}; ///< Batch
+    std::vector<std::shared_ptr<ViewType>> views{}; ///< Views received stored by slot, nullptr if not received
+    size_t nbViewsReceived = 0; ///< Number of views received
+  };
+
+  std::shared_ptr<BatchAllocator<typename ViewType::data_t>> const
+      batchAllocator_{}; ///< Allocator handing out the batch slots
+
+  std::list<PendingBatch> pendingBatches_{}; ///< Batches not complete, in opening order
+
+ public:
+  /// @brief ViewBatcher constructor
+  /// @param batchAllocator Allocator handing out the batch slots
+  explicit ViewBatcher(std::shared_ptr<BatchAllocator<typename ViewType::data_t>> batchAllocator)
+      : hh::AbstractTask<1, ViewType, ViewType>("View Batcher"), batchAllocator_(std::move(batchAllocator)) {}
+
+  /// @brief Default destructor
+  ~ViewBatcher() override = default;
+
+  /// @brief Store a finished view in its batch, and send the batches complete
+  /// @param view Finished view
+  /// @throw std::runtime_error If the view is not part of a batch
+  void execute(std::shared_ptr<ViewType> view) override {
+    auto viewData = std::dynamic_pointer_cast<BatchedViewData<typename ViewType::data_t>>(view->viewData());
+    if (!viewData || !viewData->batch()) {
+      throw std::runtime_error("Internal error: the view sent to the ViewBatcher is not part of a batch.");
+    }
+    auto pendingBatch = std::find_if(
+        pendingBatches_.begin(), pendingBatches_.end(),
+        [&viewData](auto const &pending) { return pending.batch == viewData->batch(); });
+    if (pendingBatch == pendingBatches_.end()) {
+      pendingBatches_.push_back(
+          {viewData->batch(), std::vector<std::shared_ptr<ViewType>>(viewData->batch()->capacity()), 0});
+      pendingBatch = std::prev(pendingBatches_.end());
+    }
+    pendingBatch->views.at(viewData->slot()) = view;
+    ++pendingBatch->nbViewsReceived;
+
+    for (auto pending = pendingBatches_.begin(); pending != pendingBatches_.end();) {
+      if (batchAllocator_->complete(pending->batch, pending->nbViewsReceived)) {
+        sendBatch(*pending);
+        pending = pendingBatches_.erase(pending);
+      } else { ++pending; }
+    }
+  }
+
+  /// @brief Seal and send the remaining batches, no more views will be received
+  void shutdown() override {
+    batchAllocator_->sealAll();
+    for (auto &pending : pendingBatches_) { sendBatch(pending); }
+    pendingBatches_.clear();
+  }
+
+  /// @brief Copy method, the ViewBatcher should have a single thread
+  /// @return New ViewBatcher
+  std::shared_ptr<hh::AbstractTask<1, ViewType, ViewType>> copy() override {
+    return std::make_shared<ViewBatcher<ViewType>>(batchAllocator_);
+  }
+
+ private:
+  /// @brief Send the views of a batch ordered by slot
+  /// @param pending Batch to send
+  void sendBatch(PendingBatch &pending) {
+    for (auto &view : pending.views) {
+      if (view) { this->addResult(view); }
+    }
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_VIEW_BATCHER_H
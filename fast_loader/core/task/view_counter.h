@@ -21,6 +21,7 @@
 
 #include <hedgehog/hedgehog.h>
 #include <list>
+#include <map>
 #include <ostream>
 #include <unordered_map>
 
@@ -28,7 +29,11 @@
 #include "../data/view/abstract_view.h"
 #include "../../api/data/data_type.h"
 #include "../../api/data/index_request.h"
+#include "../../api/data/region_request.h"
+#include "../../api/data/preview_request.h"
 #include "../../api/graph/options/abstract_border_creator.h"
+#include "../../api/view/tile_alias_view.h"
+#include "../request_scheduler.h"
 /// @brief FastLoader namespace
 namespace fl {
 /// @brief FastLoader internal namespace
@@ -36,7 +41,8 @@ namespace internal {
 /// @brief Task finalizing and providing the output view.
 /// @details Receive the TileRequest<ViewType> from the AbstractTileLoader, count until the number of
 /// TileRequest<ViewType> for a view is reached, fill the duplicated ghost values, and send the view. In case of
-/// ordering, a succession list is used to know which view to send next.
+/// ordering, a succession list is used to know which view to send next. If the requests are coalesced, a view is sent
+/// once per request it serves.
 /// @tparam ViewType Type of the view
 template<class ViewType>
 class ViewCounter : public hh::AbstractTask<1, TileRequest<ViewType>, ViewType> {
@@ -54,15 +60,29 @@ class ViewCounter : public hh::AbstractTask<1, TileRequest<ViewType>, ViewType>
 
   bool ordered_ = false; ///< Order preserved
 
+  std::shared_ptr<RequestScheduler>
+      requestScheduler_{}; ///< Scheduler notified when a view is sent, nullptr if not used
+
+  bool coalesce_ = false; ///< Serve the duplicate requests of a view in flight with it
+
+  std::map<std::pair<size_t, std::vector<size_t>>, std::shared_ptr<AbstractViewData<typename ViewType::data_t>>>
+      viewsInFlight_{}; ///< Views in flight that can serve duplicate requests, by level and central tile index
+
   std::mutex mutex_; ///< Mutex to protect the view ordering
+  std::mutex inFlightMutex_; ///< Mutex to protect the views in flight
 
  public:
 /// @brief ViewCounter constructor
 /// @param borderCreator Border Creator used to fill the view with ghost value created from duplication
 /// @param ordered Flag to determine if the ordering is requested
-  explicit ViewCounter(std::shared_ptr<AbstractBorderCreator<ViewType>> borderCreator, bool ordered)
+/// @param requestScheduler Scheduler notified when a view is sent, nullptr if not used [default nullptr]
+/// @param coalesce Serve the duplicate requests of a view in flight with it, not used if the ordering is requested
+/// [default false]
+  ViewCounter(std::shared_ptr<AbstractBorderCreator<ViewType>> borderCreator, bool ordered,
+              std::shared_ptr<RequestScheduler> requestScheduler = nullptr, bool coalesce = false)
       : hh::AbstractTask<1, TileRequest<ViewType>, ViewType>("View Counter"),
-        borderCreator_(borderCreator), ordered_(ordered) {
+        borderCreator_(borderCreator), ordered_(ordered), requestScheduler_(std::move(requestScheduler)),
+        coalesce_(coalesce && !ordered) {
     countMap_ = std::make_shared<std::unordered_map<std::shared_ptr<ViewType>, size_t>>();
     waitingList_ = std::make_shared<std::list<std::shared_ptr<ViewType>>>();
     indexRequests_ = std::make_shared<std::queue<std::shared_ptr<IndexRequest>>>();
@@ -78,6 +98,35 @@ class ViewCounter : public hh::AbstractTask<1, TileRequest<ViewType>, ViewType>
     indexRequests_->push(indexRequest);
   }
 
+/// @brief Serve a request with the view in flight for the same central tile and level, if any
+/// @details Only the view requests are coalesced, not the region and preview requests.
+/// @param indexRequest View request
+/// @return True if the request is served by a view in flight, else false
+  bool coalesce(std::shared_ptr<IndexRequest> const &indexRequest) {
+    if (!coalesce_ || !isCoalescable(indexRequest)) { return false; }
+    std::lock_guard<std::mutex> lk(inFlightMutex_);
+    auto viewInFlight = viewsInFlight_.find({indexRequest->level_, indexRequest->index_});
+    return viewInFlight != viewsInFlight_.end() && viewInFlight->second->coalesce(indexRequest->handle_);
+  }
+
+/// @brief Register a view in flight, to serve the duplicate requests until it is sent
+/// @param indexRequest View request
+/// @param viewData View data created for the request
+  void viewInFlight(std::shared_ptr<IndexRequest> const &indexRequest,
+                    std::shared_ptr<AbstractViewData<typename ViewType::data_t>> const &viewData) {
+    if (!coalesce_ || !isCoalescable(indexRequest)) { return; }
+    std::lock_guard<std::mutex> lk(inFlightMutex_);
+    viewsInFlight_[{indexRequest->level_, indexRequest->index_}] = viewData;
+  }
+
+/// @brief Account for a cancelled request dropped before its view has been created
+/// @param indexRequest Cancelled request
+  void requestDropped(std::shared_ptr<IndexRequest> const &indexRequest) {
+    if (std::dynamic_pointer_cast<PreviewRequest>(indexRequest)) { return; }
+    indexRequest->handle_->drop();
+    if (requestScheduler_) { requestScheduler_->viewSent(); }
+  }
+
 /// @brief Manage a TileRequest
 /// @details Receive the TileRequest<ViewType> from the AbstractTileLoader, mergeCount until the number of
 /// TileRequest<ViewType> for a view is reached, fill the duplicated ghost values, and send the view. In case of
@@ -86,7 +135,7 @@ class ViewCounter : public hh::AbstractTask<1, TileRequest<ViewType>, ViewType>
   void execute(std::shared_ptr<TileRequest<ViewType>> tileRequest) override {
     // Tile directly ready
     if (tileRequest->view()->viewData()->nbTilesToLoad() == 1) {
-      borderCreator_->fillBorderWithExistingValues(tileRequest->view());
+      fillBorder(tileRequest->view());
       dataReady(tileRequest->view());
     } else {
       // Tile not directly ready
@@ -97,7 +146,7 @@ class ViewCounter : public hh::AbstractTask<1, TileRequest<ViewType>, ViewType>
         // If all the tiles have been collected for the view, then the view is complete
         if ((*itPos).second == tileRequest->view()->viewData()->nbTilesToLoad()) {
           countMap_->erase(tileRequest->view());
-          borderCreator_->fillBorderWithExistingValues(tileRequest->view());
+          fillBorder(tileRequest->view());
           dataReady(tileRequest->view());
         }
       } else {
@@ -128,12 +177,25 @@ class ViewCounter : public hh::AbstractTask<1, TileRequest<ViewType>, ViewType>
 
  private:
 
+/// @brief Test if a request can be coalesced
+/// @param indexRequest Request to test
+/// @return True if the request is a view request, else false
+  static bool isCoalescable(std::shared_ptr<IndexRequest> const &indexRequest) {
+    return !std::dynamic_pointer_cast<RegionRequest>(indexRequest)
+        && !std::dynamic_pointer_cast<PreviewRequest>(indexRequest);
+  }
+
 /// @brief Test if the view is the next one to be send in case of ordering
 /// @param view AbstractView to test
 /// @return True if view is the next one, else false
   bool viewIsNext(std::shared_ptr<ViewType> &view) {
-    return view->indexCentralTile() == indexRequests_->front()->index_
-        && view->level() == indexRequests_->front()->level_;
+    auto const &next = indexRequests_->front();
+    auto regionRequest = std::dynamic_pointer_cast<RegionRequest>(next);
+    return view->indexCentralTile() == next->index_
+        && view->level() == next->level_
+        && view->viewData()->isRegion() == (regionRequest != nullptr)
+        && (!regionRequest
+            || (view->viewData()->minPos() == regionRequest->origin_ && view->viewDims() == regionRequest->extent_));
   }
 
 /// @brief Managed stored view on waiting list in case they are one to be send next in case of ordering
@@ -143,7 +205,7 @@ class ViewCounter : public hh::AbstractTask<1, TileRequest<ViewType>, ViewType>
       elementFound = false;
       for (auto view = waitingList_->begin(); view != waitingList_->end(); ++view) {
         if (viewIsNext(*view)) {
-          this->addResult(*view);
+          sendView(*view);
           waitingList_->erase(view);
           indexRequests_->pop();
           elementFound = true;
@@ -153,15 +215,15 @@ class ViewCounter : public hh::AbstractTask<1, TileRequest<ViewType>, ViewType>
     }
   }
 
-/// @brief Store in waiting list or send the ready view
+/// @brief Store in waiting list or send the ready view, previews are never stored
 /// @param view AbstractView to manage
   void dataReady(std::shared_ptr<ViewType> view) {
-    if (!ordered_) {
-      this->addResult(view);
+    if (!ordered_ || view->viewData()->isPreview()) {
+      sendView(view);
     } else {
       std::lock_guard<std::mutex> lk(mutex_);
       if (viewIsNext(view)) {
-        this->addResult(view);
+        sendView(view);
         indexRequests_->pop();
         handleStoredViews();
       } else {
@@ -170,6 +232,45 @@ class ViewCounter : public hh::AbstractTask<1, TileRequest<ViewType>, ViewType>
     }
   }
 
+/// @brief Fill the ghost region of a complete view, unless its request has been cancelled
+/// @details The padding of a TileAliasView is filled in the shared cached tile once per load, by AliasPhysicalToView.
+/// @param view Complete view
+  void fillBorder(std::shared_ptr<ViewType> const &view) {
+    if constexpr (!std::is_base_of_v<TileAliasView<typename ViewType::data_t>, ViewType>) {
+      if (!view->viewData()->cancelled()) { borderCreator_->fillBorderWithExistingValues(view); }
+    }
+  }
+
+/// @brief Send a view once per request it serves, or return it to its memory manager if all its requests have been
+/// cancelled, and notify the request scheduler for each request if the view is not a preview
+/// @param view AbstractView to send
+  void sendView(std::shared_ptr<ViewType> const &view) {
+    auto const viewData = view->viewData();
+    bool const isPreview = viewData->isPreview();
+    if (coalesce_ && !isPreview && !viewData->isRegion()) {
+      std::lock_guard<std::mutex> lk(inFlightMutex_);
+      auto viewInFlight = viewsInFlight_.find({viewData->level(), viewData->indexCentralTile()});
+      if (viewInFlight != viewsInFlight_.end() && viewInFlight->second == viewData) {
+        viewsInFlight_.erase(viewInFlight);
+      }
+    }
+    // A view is delivered to a request by the same transition that forbids cancelling it, so a request cancelled
+    // concurrently is either served or dropped. The preview does not deliver the request, it is sent if not cancelled.
+    auto const requestHandles = viewData->requestHandles();
+    auto const nbServed = (size_t) std::count_if(
+        requestHandles.cbegin(), requestHandles.cend(), [isPreview](auto const &handle) {
+          return !handle || (isPreview ? !handle->cancelled() : handle->deliver());
+        });
+    if (nbServed == 0) { viewData->discard(); }
+    else {
+      viewData->skipReleases(requestHandles.size() - nbServed);
+      for (size_t request = 0; request < nbServed; ++request) { this->addResult(view); }
+    }
+    if (!isPreview && requestScheduler_) {
+      for (size_t request = 0; request < requestHandles.size(); ++request) { requestScheduler_->viewSent(); }
+    }
+  }
+
 };
 }
 }
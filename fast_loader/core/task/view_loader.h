@@ -20,6 +20,8 @@
 #define FAST_LOADER_VIEW_LOADER_H
 
 #include <hedgehog/hedgehog.h>
+#include <map>
+#include <set>
 #include "../data/tile_request.h"
 #include "../../api/graph/options/abstract_border_creator.h"
 
@@ -41,12 +43,22 @@ class ViewLoader : public hh::AbstractTask<1, ViewDataType, TileRequest<ViewType
   std::shared_ptr<AbstractBorderCreator<ViewType>> const
       borderCreator_{}; ///< BorderCreator used to fill ghost region with copy
 
+  std::shared_ptr<std::vector<std::vector<size_t>>> const
+      physicalTileDimensionPerLevel_{}; ///< Physical tile dimensions per level, if set the requests target them
+
+  std::shared_ptr<TileRequestPool> const
+      tileRequestPool_ = std::make_shared<TileRequestPool>(); ///< Pool the tile requests are allocated from
+
  public:
   /// @brief ViewLoader constructor
   /// @param borderCreator BorderCreator used to fill ghost region
-  explicit ViewLoader(std::shared_ptr<AbstractBorderCreator<ViewType>> borderCreator)
+  /// @param physicalTileDimensionPerLevel Physical tile dimensions per level, if set the requests made on the view's
+  /// tiles are composed into requests on the physical tiles, the copies going straight from the physical tiles to the
+  /// view [default nullptr]
+  explicit ViewLoader(std::shared_ptr<AbstractBorderCreator<ViewType>> borderCreator,
+                      std::shared_ptr<std::vector<std::vector<size_t>>> physicalTileDimensionPerLevel = nullptr)
       : hh::AbstractTask<1, ViewDataType, TileRequest<ViewType>>("ViewLoader"),
-        borderCreator_(borderCreator) {}
+        borderCreator_(borderCreator), physicalTileDimensionPerLevel_(std::move(physicalTileDimensionPerLevel)) {}
 
   /// @brief Execute routine for ViewLoader
   /// @details Generate TileRequest come from two different sources: the first one is the system itself that will
@@ -89,6 +101,11 @@ class ViewLoader : public hh::AbstractTask<1, ViewDataType, TileRequest<ViewType
       } else { tileRequests.insert(borderTileRequest); }
     }
 
+    if (physicalTileDimensionPerLevel_) {
+      tileRequests = composeOnPhysicalTiles(
+          view, tileRequests, tileDimension, physicalTileDimensionPerLevel_->at(viewData->level()));
+    }
+
     viewData->nbTilesToLoad(tileRequests.size());
     // Send the tile request to the TileLoader
     for (auto tileRequest : tileRequests) {
@@ -99,10 +116,71 @@ class ViewLoader : public hh::AbstractTask<1, ViewDataType, TileRequest<ViewType
   /// @brief Copy method to copy ViewLoader
   /// @return New ViewLoader
   std::shared_ptr<hh::AbstractTask<1, ViewDataType, TileRequest<ViewType>>> copy() override {
-    return std::make_shared<ViewLoader<ViewType, ViewDataType>>(borderCreator_);
+    return std::make_shared<ViewLoader<ViewType, ViewDataType>>(borderCreator_, physicalTileDimensionPerLevel_);
   }
 
  private:
+  /// @brief Compose the requests made on the view's tiles into requests on the physical tiles
+  /// @details Each copy is split along the physical tiles it overlaps, the copies from the same physical tile are
+  /// gathered into a single request
+  /// @param view Destination view
+  /// @param tileRequests Requests on the view's tiles
+  /// @param tileDimension View's tile dimensions
+  /// @param physicalTileDimension Physical tile dimensions
+  /// @return Requests on the physical tiles
+  std::set<std::shared_ptr<TileRequest<ViewType>>> composeOnPhysicalTiles(
+      std::shared_ptr<ViewType> const &view, std::set<std::shared_ptr<TileRequest<ViewType>>> const &tileRequests,
+      std::vector<size_t> const &tileDimension, std::vector<size_t> const &physicalTileDimension) const {
+    size_t const nbDimensions = tileDimension.size();
+    std::map<std::vector<size_t>, std::shared_ptr<TileRequest<ViewType>>> physicalTileRequests{};
+    std::vector<size_t>
+        globalFrom(nbDimensions), minPhysicalIndex(nbDimensions), maxPhysicalIndex(nbDimensions),
+        positionFrom(nbDimensions), positionTo(nbDimensions), dimensionToCopy(nbDimensions);
+
+    for (auto const &tileRequest : tileRequests) {
+      for (auto const &copy : tileRequest->copies()) {
+        for (size_t dim = 0; dim < nbDimensions; ++dim) {
+          globalFrom.at(dim) = tileRequest->index().at(dim) * tileDimension.at(dim) + copy.positionFrom().at(dim);
+          minPhysicalIndex.at(dim) = globalFrom.at(dim) / physicalTileDimension.at(dim);
+          maxPhysicalIndex.at(dim) =
+              (globalFrom.at(dim) + copy.dimension().at(dim) - 1) / physicalTileDimension.at(dim) + 1;
+        }
+        std::vector<size_t> physicalIndex(minPhysicalIndex);
+        bool nextPhysicalTile = true;
+        while (nextPhysicalTile) {
+          for (size_t dim = 0; dim < nbDimensions; ++dim) {
+            size_t const
+                physicalFront = physicalIndex.at(dim) * physicalTileDimension.at(dim),
+                begin = std::max(globalFrom.at(dim), physicalFront),
+                end = std::min(globalFrom.at(dim) + copy.dimension().at(dim),
+                               physicalFront + physicalTileDimension.at(dim));
+            positionFrom.at(dim) = begin - physicalFront;
+            dimensionToCopy.at(dim) = end - begin;
+            positionTo.at(dim) = copy.reverseCopies().at(dim)
+                                 ? copy.positionTo().at(dim) + globalFrom.at(dim) + copy.dimension().at(dim) - end
+                                 : copy.positionTo().at(dim) + begin - globalFrom.at(dim);
+          }
+          auto &physicalTileRequest = physicalTileRequests[physicalIndex];
+          if (!physicalTileRequest) {
+            physicalTileRequest = tileRequestPool_->make<TileRequest<ViewType>>(physicalIndex, view);
+          }
+          physicalTileRequest->addCopy(CopyVolume(positionFrom, positionTo, dimensionToCopy, copy.reverseCopies()));
+
+          // Next physical tile overlapped by the copy, in row-major order
+          nextPhysicalTile = false;
+          for (size_t dim = nbDimensions; dim > 0 && !nextPhysicalTile; --dim) {
+            if (++physicalIndex.at(dim - 1) < maxPhysicalIndex.at(dim - 1)) { nextPhysicalTile = true; }
+            else { physicalIndex.at(dim - 1) = minPhysicalIndex.at(dim - 1); }
+          }
+        }
+      }
+    }
+
+    std::set<std::shared_ptr<TileRequest<ViewType>>> ret{};
+    for (auto const &[index, physicalTileRequest] : physicalTileRequests) { ret.insert(physicalTileRequest); }
+    return ret;
+  }
+
   /// @brief Create the copies
   /// @param minTileIndex Minimum tile index composing the view
   /// @param maxTileIndex Maximum tile index composing the view
@@ -137,7 +215,7 @@ class ViewLoader : public hh::AbstractTask<1, ViewDataType, TileRequest<ViewType
           std::min(maxPos.at(dimension), frontGlobalPosition + tileDimension.at(dimension))
               - positionFrom.at(dimension) - frontGlobalPosition;
       if (dimension == nbDimensions - 1) {
-        auto tileRequest = std::make_shared<TileRequest<ViewType>>(indexTileRequest, view);
+        auto tileRequest = tileRequestPool_->make<TileRequest<ViewType>>(indexTileRequest, view);
         tileRequest->addCopy(CopyVolume(positionFrom, positionTo, dimensionToCopy));
         tileRequests.insert(tileRequest);
       } else {
@@ -21,8 +21,12 @@
 
 #include <hedgehog/hedgehog.h>
 #include "view_counter.h"
+#include "../batch_allocator.h"
 #include "../data/view/abstract_view.h"
 #include "../../api/data/index_request.h"
+#include "../../api/data/region_request.h"
+#include "../../api/data/preview_request.h"
+#include "../../tools/traits.h"
 
 /// @brief FastLoader namespace
 namespace fl {
@@ -53,6 +57,9 @@ class ViewWaiter : public hh::AbstractTask<1, IndexRequest, ViewDataType> {
       nbTilesPerDimension_{}; ///< Number tiles per dimension
 
   std::vector<std::string> const dimensionNames_{}; ///< Dimension names
+
+  std::shared_ptr<BatchAllocator<typename ViewType::data_t>> const
+      batchAllocator_{}; ///< Allocator handing out the batch slots, only used with BatchedViewData
  public:
   /// @brief View waiter, get an available view from the memory manager, and attache the request to it
   /// @param ordered Flag to indicate if the views need to be served in the same order they have been requested
@@ -63,16 +70,18 @@ class ViewWaiter : public hh::AbstractTask<1, IndexRequest, ViewDataType> {
   /// @param tileDimensionPerLevel Tile dimensions per level
   /// @param radii View radii
   /// @param dimensionNames Dimension names
+  /// @param batchAllocator Allocator handing out the batch slots, only used with BatchedViewData [default nullptr]
   ViewWaiter(
       bool const ordered, FillingType const fillingType,
       std::shared_ptr<ViewCounter<ViewType>> const viewCounter,
       std::shared_ptr<std::vector<std::vector<size_t>>> const &fullDimensionPerLevel,
       std::shared_ptr<std::vector<std::vector<size_t>>> const &tileDimensionPerLevel,
-      std::vector<size_t> const &radii, std::vector<std::string> const& dimensionNames)
+      std::vector<size_t> const &radii, std::vector<std::string> const& dimensionNames,
+      std::shared_ptr<BatchAllocator<typename ViewType::data_t>> const &batchAllocator = nullptr)
       : hh::AbstractTask<1, IndexRequest, ViewDataType>("View Waiter"),
         ordered_(ordered), level_(0), fillingType_(fillingType), viewCounter_(viewCounter),
         fullDimensionPerLevel_(fullDimensionPerLevel), tileDimensionPerLevel_(tileDimensionPerLevel),        
-        radii_(radii), dimensionNames_(dimensionNames) {   
+        radii_(radii), dimensionNames_(dimensionNames), batchAllocator_(batchAllocator) {
   }
 
   /// @brief Default destructor
@@ -96,7 +105,33 @@ class ViewWaiter : public hh::AbstractTask<1, IndexRequest, ViewDataType> {
   /// @param indexRequest Index request for getting a view
   void execute(std::shared_ptr<IndexRequest> indexRequest) override {
     if (!indexRequest) { throw (std::runtime_error("You can not create a view from an empty view request.")); }
-    else {
+    else if (indexRequest->cancelled()) { viewCounter_->requestDropped(indexRequest); }
+    else if (auto regionRequest = std::dynamic_pointer_cast<RegionRequest>(indexRequest)) {
+      bool isRegionRequestValid =
+          regionRequest->origin_.size() == fullDimension_.size() && regionRequest->extent_.size() == fullDimension_.size();
+      for (size_t i = 0; i < fullDimension_.size() && isRegionRequestValid; ++i) {
+        isRegionRequestValid &= regionRequest->origin_.at(i) < fullDimension_.at(i) && regionRequest->extent_.at(i) > 0;
+      }
+      if (!isRegionRequestValid) {
+        std::ostringstream oss;
+        oss << "The " << *regionRequest << " can't be requested.";
+        throw (std::runtime_error(oss.str()));
+      }
+      auto viewData = std::dynamic_pointer_cast<ViewDataType>(this->getManagedMemory());
+      viewData->initializeRegion(
+          fullDimension_, tileDimension_, regionRequest->origin_, regionRequest->extent_, nbTilesPerDimension_,
+          dimensionNames_, fillingType_, level_
+      );
+      // Only the views owning their buffer can be requested as a region, see FastLoaderGraph::requestRegion
+      if constexpr (traits::owns_buffer_v<ViewType>) {
+        viewData->reserve(std::accumulate(
+            regionRequest->extent_.cbegin(), regionRequest->extent_.cend(), (size_t) 1, std::multiplies<>()));
+      }
+      viewData->noCache(regionRequest->noCache_);
+      viewData->requestHandle(regionRequest->handle_);
+      if (ordered_) { viewCounter_->addIndexRequest(indexRequest); }
+      this->addResult(viewData);
+    } else {
       bool isIndexRequestValid = indexRequest->level_ < fullDimensionPerLevel_->size();
       if(indexRequest->index_.size() == nbTilesPerDimension_.size()){
         for(size_t i = 0; i < indexRequest->index_.size() && isIndexRequestValid; ++i){
@@ -110,12 +145,20 @@ class ViewWaiter : public hh::AbstractTask<1, IndexRequest, ViewDataType> {
         std::copy(indexRequest->index_.cbegin(), indexRequest->index_.cend(), std::ostream_iterator<size_t>(oss, ", "));
         oss << "] for the level " << indexRequest->level_ << " can't be requested.";
         throw (std::runtime_error(oss.str()));
-      } else {
+      } else if (!viewCounter_->coalesce(indexRequest)) { // A duplicate request is served by the view in flight
         auto viewData = std::dynamic_pointer_cast<ViewDataType>(this->getManagedMemory());
         viewData->initialize(
             fullDimension_, tileDimension_, radii_, indexRequest->index_, nbTilesPerDimension_, dimensionNames_, fillingType_, level_
         );
-        if (ordered_) { viewCounter_->addIndexRequest(indexRequest); }
+        viewData->noCache(indexRequest->noCache_);
+        viewData->requestHandle(indexRequest->handle_);
+        if constexpr (std::is_base_of_v<BatchedViewData<typename ViewType::data_t>, ViewDataType>) {
+          batchAllocator_->bind(*viewData, level_);
+        }
+        // A preview is sent as soon as it is built, it is not part of the ordering
+        if (std::dynamic_pointer_cast<PreviewRequest>(indexRequest)) { viewData->preview(true); }
+        else if (ordered_) { viewCounter_->addIndexRequest(indexRequest); }
+        viewCounter_->viewInFlight(indexRequest, viewData);
         this->addResult(viewData);
       }
     }
@@ -125,7 +168,7 @@ class ViewWaiter : public hh::AbstractTask<1, IndexRequest, ViewDataType> {
   /// @return New instance of this task
   std::shared_ptr<hh::AbstractTask<1, IndexRequest, ViewDataType>> copy() override {
     return std::make_shared<ViewWaiter>(ordered_, fillingType_, viewCounter_, fullDimensionPerLevel_,
-                                        tileDimensionPerLevel_, radii_, dimensionNames_);
+                                        tileDimensionPerLevel_, radii_, dimensionNames_, batchAllocator_);
   }
 };
 
@@ -0,0 +1,167 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_TILE_REQUEST_POOL_H
+#define FAST_LOADER_TILE_REQUEST_POOL_H
+
+#include <memory>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Pool of memory blocks used to allocate the tile requests and their copies
+/// @details The blocks are gathered by size. A released block is kept in the pool and handed out again for the next
+/// allocation of the same size, so once the requests of a first view have been released the following views do not
+/// hit the heap anymore. The pool is thread-safe: the requests are created by one task and released by others.
+class TileRequestPool : public std::enable_shared_from_this<TileRequestPool> {
+ private:
+  std::unordered_map<size_t, std::vector<void *>> freeBlocksPerSize_{}; ///< Released blocks per size
+  std::mutex mutex_{}; ///< Mutex protecting the free blocks
+  size_t
+      nbBlocksAllocated_ = 0, ///< Number of blocks allocated from the heap
+      nbBlocksRecycled_ = 0; ///< Number of blocks handed out again from the pool
+
+ public:
+  /// @brief Default constructor
+  TileRequestPool() = default;
+
+  /// @brief Destructor, release the blocks to the heap
+  /// @details All the allocators hold the pool, so no block is in use at this point
+  virtual ~TileRequestPool() {
+    for (auto &[size, freeBlocks] : freeBlocksPerSize_) {
+      for (auto block : freeBlocks) { ::operator delete(block); }
+    }
+  }
+
+  /// @brief Number of blocks allocated from the heap accessor
+  /// @return Number of blocks allocated from the heap
+  [[nodiscard]] size_t nbBlocksAllocated() {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return nbBlocksAllocated_;
+  }
+
+  /// @brief Number of blocks handed out again from the pool accessor
+  /// @return Number of blocks handed out again from the pool
+  [[nodiscard]] size_t nbBlocksRecycled() {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return nbBlocksRecycled_;
+  }
+
+  /// @brief Get a block, from the pool if one of the same size has been released, else from the heap
+  /// @param size Size of the block in bytes
+  /// @return Block of at least size bytes
+  void *allocate(size_t size) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    auto &freeBlocks = freeBlocksPerSize_[size];
+    if (freeBlocks.empty()) {
+      ++nbBlocksAllocated_;
+      return ::operator new(size);
+    }
+    ++nbBlocksRecycled_;
+    void *block = freeBlocks.back();
+    freeBlocks.pop_back();
+    return block;
+  }
+
+  /// @brief Give back a block to the pool
+  /// @param block Block to give back
+  /// @param size Size of the block in bytes
+  void deallocate(void *block, size_t size) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    freeBlocksPerSize_[size].push_back(block);
+  }
+
+  /// @brief Create an object, its control block and its storage, from the pool
+  /// @details The object constructor receives the pool as last argument to allocate its inner containers from it
+  /// @tparam T Type of the object to create
+  /// @tparam Args Types of the constructor arguments
+  /// @param args Constructor arguments
+  /// @return Shared pointer to the created object
+  template<class T, class ...Args>
+  std::shared_ptr<T> make(Args &&...args);
+};
+
+/// @brief Standard allocator getting its memory from a TileRequestPool, or from the heap if it has no pool
+/// @details The allocator holds the pool, so the pool outlives all the objects allocated from it
+/// @tparam T Type of the allocated objects
+template<class T>
+class PoolAllocator {
+  static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "The pool only provides the default new alignment.");
+ private:
+  std::shared_ptr<TileRequestPool> pool_ = nullptr; ///< Pool to allocate from, nullptr for the heap
+
+ public:
+  using value_type = T; ///< Type of the allocated objects
+
+  /// @brief Default constructor, allocate from the heap
+  PoolAllocator() = default;
+
+  /// @brief Constructor from a pool
+  /// @param pool Pool to allocate from
+  explicit PoolAllocator(std::shared_ptr<TileRequestPool> pool) : pool_(std::move(pool)) {}
+
+  /// @brief Rebind constructor
+  /// @tparam U Type allocated by rhs
+  /// @param rhs Allocator to rebind
+  template<class U>
+  PoolAllocator(PoolAllocator<U> const &rhs) : pool_(rhs.pool()) {}
+
+  /// @brief Pool accessor
+  /// @return Pool to allocate from, nullptr for the heap
+  [[nodiscard]] std::shared_ptr<TileRequestPool> const &pool() const { return pool_; }
+
+  /// @brief Allocate n objects
+  /// @param n Number of objects
+  /// @return Pointer to the allocated storage
+  T *allocate(size_t n) {
+    if (pool_) { return static_cast<T *>(pool_->allocate(n * sizeof(T))); }
+    return std::allocator<T>().allocate(n);
+  }
+
+  /// @brief Deallocate n objects
+  /// @param ptr Pointer to the storage
+  /// @param n Number of objects
+  void deallocate(T *ptr, size_t n) {
+    if (pool_) { pool_->deallocate(ptr, n * sizeof(T)); }
+    else { std::allocator<T>().deallocate(ptr, n); }
+  }
+
+  /// @brief Equality operator, allocators are interchangeable if they share the same pool
+  /// @tparam U Type allocated by rhs
+  /// @param rhs Allocator to compare against
+  /// @return True if the allocators share the same pool
+  template<class U>
+  bool operator==(PoolAllocator<U> const &rhs) const { return pool_ == rhs.pool(); }
+};
+
+template<class T, class ...Args>
+std::shared_ptr<T> TileRequestPool::make(Args &&...args) {
+  return std::allocate_shared<T>(
+      PoolAllocator<T>(shared_from_this()), std::forward<Args>(args)..., shared_from_this());
+}
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_TILE_REQUEST_POOL_H
@@ -42,6 +42,23 @@ class NaiveTraversal : public AbstractTraversal {
     return traversal;
   }
 
+  /// @brief Random access flag
+  /// @return True, the positions are computed from the step
+  [[nodiscard]] bool randomAccess() const override { return true; }
+
+  /// @brief Compute a position of the traversal, the step is unraveled with the last dimension varying fastest
+  /// @param nbTilesPerDimension Number of tiles per dimension
+  /// @param step Step in the traversal
+  /// @return Position at the step
+  [[nodiscard]] std::vector<size_t> position(std::vector<size_t> const &nbTilesPerDimension, size_t step) const override {
+    std::vector<size_t> position(nbTilesPerDimension.size());
+    for (size_t dimension = nbTilesPerDimension.size(); dimension-- > 0;) {
+      position.at(dimension) = step % nbTilesPerDimension.at(dimension);
+      step /= nbTilesPerDimension.at(dimension);
+    }
+    return position;
+  }
+
   /// @brief Create the traversal by traversing all dimensions in order
   /// @param traversal Returned traversal
   /// @param nbTilesPerDimension Number of tiles per dimension
@@ -0,0 +1,304 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the
+// software in any medium, provided that you keep intact this entire notice. You may improve, modify and create
+// derivative works of the software or any portion of the software, and you may copy and distribute such modifications
+// or works. Modified works should carry a notice stating that you changed the software and should note the date and
+// nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the
+// source of the software. NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND,
+// EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+// WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE
+// CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS
+// THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE. You
+// are solely responsible for determining the appropriateness of using and distributing the software and you assume
+// all risks associated with its use, including but not limited to the risks and costs of program errors, compliance
+// with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of
+// operation. This software is not intended to be used in any situation where a failure could cause risk of injury or
+// damage to property. The software developed by NIST employees is not subject to copyright protection within the
+// United States.
+
+#ifndef FAST_LOADER_VIRTUAL_LEVEL_TILE_LOADER_H
+#define FAST_LOADER_VIRTUAL_LEVEL_TILE_LOADER_H
+
+#include <cmath>
+#include "../api/data/data_type.h"
+#include "../api/graph/abstract_tile_loader.h"
+
+/// @brief FastLoader namespace
+namespace fl {
+/// @brief FastLoader internal namespace
+namespace internal {
+
+/// @brief Tile loader adding virtual pyramid levels on top of the levels of a user tile loader
+/// @details A virtual level is synthesized from the level below, downsampled by 2 for the chosen dimensions, with the
+/// same tile dimensions. The tile of a virtual level is built from the tiles of the level below acquired one at a time
+/// through the caches (loaded or synthesized if not cached), the synthesized tiles are cached as any other tile. The
+/// file levels are forwarded to the user tile loader.
+/// @tparam ViewType Type of the view
+template<class ViewType>
+class VirtualLevelTileLoader : public AbstractTileLoader<ViewType> {
+ private:
+  using DataType = typename ViewType::data_t; ///< Sample type
+  std::shared_ptr<AbstractTileLoader<ViewType>> const fileTileLoader_{}; ///< User tile loader for the file levels
+  size_t const nbVirtualLevels_{}; ///< Number of virtual levels
+  DownsamplingType const downsamplingType_{}; ///< Downsampling used to synthesize the virtual levels
+  std::vector<bool> const downsampledDimensions_{}; ///< Dimensions downsampled
+  std::vector<std::vector<size_t>>
+      fullDimensionPerVirtualLevel_{}, ///< Full dimensions of the virtual levels
+      tileDimensionPerVirtualLevel_{}; ///< Tile dimensions of the virtual levels
+  std::vector<std::vector<DataType>>
+      blockPerVirtualLevel_{}; ///< Block of the level below covered by the synthesized tile, per level for recursion
+  std::vector<DataType> window_{}; ///< Samples downsampled to a single value
+
+ public:
+  /// @brief VirtualLevelTileLoader constructor
+  /// @param fileTileLoader User tile loader for the file levels
+  /// @param nbVirtualLevels Number of virtual levels
+  /// @param downsamplingType Downsampling used to synthesize the virtual levels
+  /// @param downsampledDimensions Dimensions downsampled
+  VirtualLevelTileLoader(std::shared_ptr<AbstractTileLoader<ViewType>> fileTileLoader, size_t nbVirtualLevels,
+                         DownsamplingType downsamplingType, std::vector<bool> downsampledDimensions)
+      : AbstractTileLoader<ViewType>(fileTileLoader->name(), fileTileLoader->filePath(),
+                                     fileTileLoader->numberThreads()),
+        fileTileLoader_(std::move(fileTileLoader)), nbVirtualLevels_(nbVirtualLevels),
+        downsamplingType_(downsamplingType), downsampledDimensions_(std::move(downsampledDimensions)) {
+    this->metadata_ = fileTileLoader_->metadata();
+    auto fullDimension = fileTileLoader_->fullDims(fileTileLoader_->nbPyramidLevels() - 1);
+    auto const &tileDimension = fileTileLoader_->tileDims(fileTileLoader_->nbPyramidLevels() - 1);
+    for (size_t level = 0; level < nbVirtualLevels_; ++level) {
+      for (size_t dim = 0; dim < fullDimension.size(); ++dim) {
+        if (downsampledDimensions_.at(dim)) { fullDimension.at(dim) = (fullDimension.at(dim) + 1) / 2; }
+      }
+      fullDimensionPerVirtualLevel_.push_back(fullDimension);
+      tileDimensionPerVirtualLevel_.push_back(tileDimension);
+    }
+    blockPerVirtualLevel_.resize(nbVirtualLevels_);
+    window_.reserve((size_t) 1 << std::count(downsampledDimensions_.cbegin(), downsampledDimensions_.cend(), true));
+  }
+
+  /// @brief Default destructor
+  ~VirtualLevelTileLoader() override = default;
+
+  /// @brief Initialize the user tile loader
+  void initializeTileLoader() override { fileTileLoader_->initializeTileLoader(); }
+
+  /// @brief Copy the tile loader with a copy of the user tile loader
+  /// @return Copy of the tile loader
+  std::shared_ptr<AbstractTileLoader<ViewType>> copyTileLoader() override {
+    auto fileTileLoaderCopy = fileTileLoader_->copyTileLoader();
+    if (!fileTileLoaderCopy) {
+      throw std::runtime_error(
+          "The copyTileLoader method redefined for the tile loader return a non valid TileLoader.");
+    }
+    return std::make_shared<VirtualLevelTileLoader<ViewType>>(
+        fileTileLoaderCopy, nbVirtualLevels_, downsamplingType_, downsampledDimensions_);
+  }
+
+  /// @brief Downscale factor accessor, doubled for each virtual level
+  /// @param level Pyramidal level
+  /// @return Downscale factor
+  float downScaleFactor(std::size_t const level) override {
+    if (level < nbFileLevels()) { return fileTileLoader_->downScaleFactor(level); }
+    return fileTileLoader_->downScaleFactor(nbFileLevels() - 1) * (float) std::pow(2, level - nbFileLevels() + 1);
+  }
+
+  /// @brief Load a tile from the file for the file levels, synthesize it for the virtual levels
+  /// @param tile Allocated buffer to fill
+  /// @param index Position of the tile
+  /// @param level Level of the tile
+  void loadTileFromFile(std::shared_ptr<TileBuffer<DataType>> tile, std::vector<size_t> const &index,
+                        size_t level) override {
+    if (level < nbFileLevels()) { fileTileLoader_->loadTileFromFile(tile, index, level); }
+    else { synthesizeTile(*tile, index, level); }
+  }
+
+  /// @brief Number of dimensions accessor
+  /// @return Number of dimensions
+  [[nodiscard]] size_t nbDims() const override { return fileTileLoader_->nbDims(); }
+  /// @brief Number of pyramidal levels accessor, file levels and virtual levels
+  /// @return Number of pyramidal levels
+  [[nodiscard]] size_t nbPyramidLevels() const override { return nbFileLevels() + nbVirtualLevels_; }
+  /// @brief Number of levels in the file accessor
+  /// @return Number of levels in the file
+  [[nodiscard]] size_t nbFileLevels() const { return fileTileLoader_->nbPyramidLevels(); }
+  /// @brief File dimensions accessor
+  /// @param level Pyramidal level
+  /// @return File dimensions
+  [[nodiscard]] std::vector<size_t> const &fullDims(std::size_t level) const override {
+    if (level < nbFileLevels()) { return fileTileLoader_->fullDims(level); }
+    return fullDimensionPerVirtualLevel_.at(level - nbFileLevels());
+  }
+  /// @brief Tile dimensions accessor
+  /// @param level Pyramidal level
+  /// @return Tile dimensions
+  [[nodiscard]] std::vector<size_t> const &tileDims(std::size_t level) const override {
+    if (level < nbFileLevels()) { return fileTileLoader_->tileDims(level); }
+    return tileDimensionPerVirtualLevel_.at(level - nbFileLevels());
+  }
+  /// @brief Dimension names accessor
+  /// @return Dimension names
+  [[nodiscard]] std::vector<std::string> const &dimNames() const override { return fileTileLoader_->dimNames(); }
+
+ private:
+  /// @brief Synthesize a tile of a virtual level from the tiles of the level below
+  /// @param tile Buffer to fill
+  /// @param index Position of the tile
+  /// @param level Virtual level of the tile
+  void synthesizeTile(TileBuffer<DataType> &tile, std::vector<size_t> const &index, size_t level) {
+    size_t const sourceLevel = level - 1, nbDimensions = nbDims();
+    auto const
+        &tileDimension = tileDims(level),
+        &sourceTileDimension = tileDims(sourceLevel),
+        &sourceFullDimension = fullDims(sourceLevel);
+
+    std::vector<size_t>
+        blockOrigin(nbDimensions), blockDimension(nbDimensions), blockValidDimension(nbDimensions),
+        minSourceIndex(nbDimensions), maxSourceIndex(nbDimensions);
+    for (size_t dim = 0; dim < nbDimensions; ++dim) {
+      size_t const factor = downsampledDimensions_.at(dim) ? 2 : 1;
+      blockOrigin.at(dim) = index.at(dim) * tileDimension.at(dim) * factor;
+      blockDimension.at(dim) = tileDimension.at(dim) * factor;
+      blockValidDimension.at(dim) =
+          std::min(blockDimension.at(dim), sourceFullDimension.at(dim) - blockOrigin.at(dim));
+      minSourceIndex.at(dim) = blockOrigin.at(dim) / sourceTileDimension.at(dim);
+      maxSourceIndex.at(dim) = (blockOrigin.at(dim) + blockValidDimension.at(dim) + sourceTileDimension.at(dim) - 1)
+          / sourceTileDimension.at(dim);
+    }
+    auto &block = blockPerVirtualLevel_.at(level - nbFileLevels());
+    block.resize(std::accumulate(blockDimension.cbegin(), blockDimension.cend(), (size_t) 1, std::multiplies<>()));
+
+    // Gather the block, the source tiles are acquired one at a time so a small cache can not be exhausted
+    std::vector<size_t> sourceIndex(minSourceIndex);
+    do {
+      auto cachedTile = this->cache(sourceLevel)->lockedTile(sourceIndex);
+      cachedTile->lock();
+      if (cachedTile->newTile()) {
+        cachedTile->newTile(false);
+        if (!this->cache(sourceLevel)->restoreTile(cachedTile)) {
+          loadTileFromFile(cachedTile->data(), sourceIndex, sourceLevel);
+          this->cache(sourceLevel)->saveTile(cachedTile);
+        }
+      }
+      copyToBlock(block, *cachedTile->data(), sourceIndex, sourceTileDimension, sourceFullDimension,
+                  blockOrigin, blockDimension, blockValidDimension);
+      cachedTile->unlock();
+      cachedTile->releaseSemaphore();
+    } while (nextPosition(sourceIndex, minSourceIndex, maxSourceIndex));
+
+    // Downsample the block into the tile
+    std::vector<size_t> position(nbDimensions, 0), zeros(nbDimensions, 0);
+    size_t tilePosition = 0;
+    do {
+      tile.at(tilePosition++) = downsample(block, position, blockDimension, blockValidDimension);
+    } while (nextPosition(position, zeros, tileDimension));
+  }
+
+  /// @brief Copy the part of a source tile inside the block
+  /// @param block Block to fill
+  /// @param sourceTile Source tile data
+  /// @param sourceIndex Source tile index
+  /// @param sourceTileDimension Source tile dimensions
+  /// @param sourceFullDimension Source level full dimensions
+  /// @param blockOrigin Global position of the block in the source level
+  /// @param blockDimension Block dimensions
+  /// @param blockValidDimension Block dimensions inside of the source level
+  void copyToBlock(std::vector<DataType> &block, TileBuffer<DataType> const &sourceTile,
+                   std::vector<size_t> const &sourceIndex,
+                   std::vector<size_t> const &sourceTileDimension, std::vector<size_t> const &sourceFullDimension,
+                   std::vector<size_t> const &blockOrigin, std::vector<size_t> const &blockDimension,
+                   std::vector<size_t> const &blockValidDimension) {
+    size_t const nbDimensions = sourceIndex.size(), lastDim = nbDimensions - 1;
+    std::vector<size_t> begin(nbDimensions), end(nbDimensions);
+    for (size_t dim = 0; dim < nbDimensions; ++dim) {
+      size_t const tileOrigin = sourceIndex.at(dim) * sourceTileDimension.at(dim);
+      begin.at(dim) = std::max(tileOrigin, blockOrigin.at(dim));
+      end.at(dim) = std::min({tileOrigin + sourceTileDimension.at(dim), sourceFullDimension.at(dim),
+                              blockOrigin.at(dim) + blockValidDimension.at(dim)});
+    }
+    // Copy row by row along the last dimension
+    std::vector<size_t> rowBegin(begin), rowEnd(end);
+    rowEnd.at(lastDim) = begin.at(lastDim) + 1;
+    std::vector<size_t> position(begin);
+    do {
+      size_t sourcePosition = 0, blockPosition = 0;
+      for (size_t dim = 0; dim < nbDimensions; ++dim) {
+        sourcePosition = sourcePosition * sourceTileDimension.at(dim)
+            + position.at(dim) - sourceIndex.at(dim) * sourceTileDimension.at(dim);
+        blockPosition = blockPosition * blockDimension.at(dim) + position.at(dim) - blockOrigin.at(dim);
+      }
+      std::copy_n(sourceTile.cbegin() + (long) sourcePosition, end.at(lastDim) - begin.at(lastDim),
+                  block.begin() + (long) blockPosition);
+    } while (nextPosition(position, rowBegin, rowEnd));
+  }
+
+  /// @brief Downsample the samples of the block corresponding to a position in the synthesized tile
+  /// @param block Block of the level below
+  /// @param position Position in the synthesized tile
+  /// @param blockDimension Block dimensions
+  /// @param blockValidDimension Block dimensions inside of the source level
+  /// @return Downsampled value, default value if the position is outside of the level
+  DataType downsample(std::vector<DataType> const &block, std::vector<size_t> const &position,
+                      std::vector<size_t> const &blockDimension,
+                      std::vector<size_t> const &blockValidDimension) {
+    size_t const nbDimensions = position.size();
+    std::vector<size_t> windowBegin(nbDimensions), windowEnd(nbDimensions);
+    for (size_t dim = 0; dim < nbDimensions; ++dim) {
+      size_t const factor = downsampledDimensions_.at(dim) ? 2 : 1;
+      windowBegin.at(dim) = position.at(dim) * factor;
+      windowEnd.at(dim) = std::min(windowBegin.at(dim) + factor, blockValidDimension.at(dim));
+      if (windowBegin.at(dim) >= windowEnd.at(dim)) { return DataType(); }
+    }
+    window_.clear();
+    std::vector<size_t> windowPosition(windowBegin);
+    do {
+      size_t blockPosition = 0;
+      for (size_t dim = 0; dim < nbDimensions; ++dim) {
+        blockPosition = blockPosition * blockDimension.at(dim) + windowPosition.at(dim);
+      }
+      window_.push_back(block.at(blockPosition));
+    } while (nextPosition(windowPosition, windowBegin, windowEnd));
+
+    switch (downsamplingType_) {
+      case DownsamplingType::MEAN: {
+        double const mean =
+            std::accumulate(window_.cbegin(), window_.cend(), 0., std::plus<>()) / (double) window_.size();
+        if constexpr (std::is_integral_v<DataType>) { return (DataType) std::round(mean); }
+        else { return (DataType) mean; }
+      }
+      case DownsamplingType::MAX:return *std::max_element(window_.cbegin(), window_.cend());
+      case DownsamplingType::MODE: {
+        std::sort(window_.begin(), window_.end());
+        DataType mode = window_.front();
+        size_t modeCount = 0;
+        for (auto begin = window_.cbegin(); begin != window_.cend();) {
+          auto end = std::upper_bound(begin, window_.cend(), *begin);
+          if ((size_t) std::distance(begin, end) > modeCount) {
+            modeCount = (size_t) std::distance(begin, end);
+            mode = *begin;
+          }
+          begin = end;
+        }
+        return mode;
+      }
+    }
+    return DataType();
+  }
+
+  /// @brief Go to the next position in a box, in row-major order
+  /// @param position Current position, updated
+  /// @param begin Box front
+  /// @param end Box back (excluded)
+  /// @return False if the position was the last one of the box
+  static bool nextPosition(std::vector<size_t> &position, std::vector<size_t> const &begin,
+                           std::vector<size_t> const &end) {
+    for (size_t dim = position.size(); dim > 0; --dim) {
+      if (++position.at(dim - 1) < end.at(dim - 1)) { return true; }
+      position.at(dim - 1) = begin.at(dim - 1);
+    }
+    return false;
+  }
+};
+
+} // fl
+} // internal
+
+#endif //FAST_LOADER_VIRTUAL_LEVEL_TILE_LOADER_H
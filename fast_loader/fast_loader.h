@@ -22,11 +22,21 @@
 #include "api/graph/options/abstract_border_creator.h"
 #include "api/graph/abstract_tile_loader.h"
 #include "api/graph/options/abstract_traversal.h"
+#include "api/graph/options/abstract_buffer_allocator.h"
 #include "api/graph/adaptive/adaptive_fast_loader_graph.h"
 #include "api/view/default_view.h"
+#include "api/view/tile_alias_view.h"
+#include "api/view/batched_view.h"
 #include "api/graph/fast_loader_configuration.h"
 #include "api/graph/fast_loader_graph.h"
 #include "api/data/index_request.h"
+#include "api/data/request_handle.h"
+#include "api/data/region_request.h"
+#include "api/data/preview_request.h"
+#include "api/data/view_batch.h"
+#include "api/data/view_pool_statistics.h"
+#include "api/data/loader_tuning_statistics.h"
+#include "api/data/tile_buffer.h"
 #ifdef HH_USE_CUDA
 #include "api/view/unified_view.h"
 #endif //HH_USE_CUDA
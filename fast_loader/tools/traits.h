@@ -22,6 +22,8 @@
 #include <type_traits>
 #include "../api/view/default_view.h"
 #include "../api/view/unified_view.h"
+#include "../api/view/tile_alias_view.h"
+#include "../api/view/batched_view.h"
 
 
 /// @brief FastLoader namespace
@@ -53,9 +55,14 @@ struct IsView {
 #ifdef HH_USE_CUDA
               std::disjunction_v<
               std::is_base_of<DefaultView < typename ViewType::data_t>, ViewType >,
+              std::is_base_of<TileAliasView < typename ViewType::data_t>, ViewType >,
+              std::is_base_of<BatchedView < typename ViewType::data_t>, ViewType >,
               std::is_base_of<UnifiedView < typename ViewType::data_t>, ViewType >> &&
 #else //HH_USE_CUDA
-              std::is_base_of_v<DefaultView < typename ViewType::data_t>, ViewType > &&
+              std::disjunction_v<
+              std::is_base_of<DefaultView < typename ViewType::data_t>, ViewType >,
+              std::is_base_of<TileAliasView < typename ViewType::data_t>, ViewType >,
+              std::is_base_of<BatchedView < typename ViewType::data_t>, ViewType >> &&
 #endif
               std::is_arithmetic_v<typename ViewType::data_t>); ///< Test's value
 };
@@ -64,6 +71,14 @@ struct IsView {
 /// @tparam ViewType Type to test
 template<class ViewType>
 inline constexpr bool is_view_v = IsView<ViewType>::value;
+
+/// @brief Trait to test if the views of a type own their buffer, so they can be sized to a region request, unlike the
+/// TileAliasView aliasing a cached tile and the BatchedView using a slot of a batch
+/// @tparam ViewType Type to test
+template<class ViewType>
+inline constexpr bool owns_buffer_v =
+    !std::is_base_of_v<TileAliasView<typename ViewType::data_t>, ViewType>
+        && !std::is_base_of_v<BatchedView<typename ViewType::data_t>, ViewType>;
 }
 }
 }
@@ -57,18 +57,20 @@ void testAdaptiveFL() {
   std::vector<size_t> const
       nbDimensions{1, 2, 3},
       fullSize{2, 5, 9},
-      tileSize{1, 2},
-      physicalTileSize{1, 2},
+      tileSize{1, 2, 3},
+      physicalTileSize{1, 2, 3},
       radius{0, 1, 2};
   for (auto dim : nbDimensions) {
     for (auto fs : fullSize) {
       for (auto ts : tileSize) {
         for (auto pts : physicalTileSize) {
+          if (fs < ts || fs < pts) { continue; }
           for (auto r : radius) {
             auto fl = createFL(dim, fs, ts, r);
             auto afl = createAdaptiveFL(dim, fs, ts, pts, r);
 
             ASSERT_EQ(fl.nbTilesDims(0), afl.nbTilesDims(0));
+            ASSERT_EQ(afl.logicalCacheUsed(), ts % pts != 0 && pts % ts != 0);
 
             fl.executeGraph();
             //fl.createDotFile("fl.dot", hh::ColorScheme::EXECUTION, hh::StructureOptions::QUEUE, hh::InputOptions::GATHERED);
@@ -114,4 +116,52 @@ void testAdaptiveFL() {
 
 }
 
+void testAdaptiveSelectedTileDimensions() {
+  std::vector<size_t> const fs{16, 16}, pts{4, 4};
+  for (size_t nbViewsTarget : {1, 4, 64}) {
+    for (size_t r : {0, 3}) {
+      auto tl = std::make_shared<VirtualFileTileLoader>(1, fs, pts);
+      auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+      options->radius(r);
+      options->ordered(true);
+      options->cacheCapacityMB({1});
+      auto selected = fl::AdaptiveFastLoaderGraph<fl::DefaultView<int>>::selectLogicalTileDimensions(
+          *options, nbViewsTarget);
+      auto afl = fl::AdaptiveFastLoaderGraph<fl::DefaultView<int>>(std::move(options), nbViewsTarget);
+      ASSERT_EQ(selected.size(), (size_t) 1);
+      for (size_t dim = 0; dim < 2; ++dim) {
+        ASSERT_TRUE(selected.at(0).at(dim) % pts.at(dim) == 0 || pts.at(dim) % selected.at(0).at(dim) == 0);
+      }
+      ASSERT_EQ(afl.logicalTileDims(0), selected.at(0));
+      ASSERT_FALSE(afl.logicalCacheUsed());
+
+      if (selected.at(0).at(0) != selected.at(0).at(1)) { continue; }
+      auto fl = createFL(2, 16, selected.at(0).at(0), r);
+      fl.executeGraph();
+      fl.requestAllViews(0);
+      fl.finishRequestingViews();
+      afl.executeGraph();
+      afl.requestAllViews(0);
+      afl.finishRequestingViews();
+      while (auto viewVariantFL = fl.getBlockingResult()) {
+        auto flRes = std::get<std::shared_ptr<fl::DefaultView<int>>>(*viewVariantFL);
+        auto aflRes = std::get<std::shared_ptr<fl::DefaultView<int>>>(*afl.getBlockingResult());
+        ASSERT_EQ(aflRes->indexCentralTile(), flRes->indexCentralTile());
+        ASSERT_TRUE(std::equal(
+            flRes->viewOrigin(),
+            flRes->viewOrigin()
+                + std::accumulate(flRes->viewDims().cbegin(), flRes->viewDims().cend(), (long) 1, std::multiplies<>()),
+            aflRes->viewOrigin()));
+        flRes->returnToMemoryManager();
+        aflRes->returnToMemoryManager();
+      }
+      fl.waitForTermination();
+      afl.waitForTermination();
+    }
+  }
+  auto tl = std::make_shared<VirtualFileTileLoader>(1, fs, pts);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+  ASSERT_THROW(fl::AdaptiveFastLoaderGraph<fl::DefaultView<int>>(std::move(options), 0), std::runtime_error);
+}
+
 #endif //FAST_LOADER_TEST_ADAPTIVE_H
@@ -22,7 +22,11 @@
 #include <gtest/gtest.h>
 #include <cmath>
 #include <utility>
+#include <thread>
 #include "../fast_loader/core/cache.h"
+#include "../fast_loader/core/numa_topology.h"
+#include "../fast_loader/core/compression/compressed_cache.h"
+#include "../fast_loader/core/disk_tile_cache.h"
 
 void cacheInitialization(std::vector<size_t> const &cacheDimension,
                          size_t nbTilesCache,
@@ -122,4 +126,300 @@ void testCache(){
   }
 }
 
+void testNumaCache() {
+  using Topology = fl::internal::NumaTopology;
+  ASSERT_EQ(Topology::parseCpuList("0-3,8,10-11\n"), std::vector<int>({0, 1, 2, 3, 8, 10, 11}));
+  ASSERT_EQ(Topology::parseCpuList("5"), std::vector<int>({5}));
+  ASSERT_TRUE(Topology::parseCpuList("").empty());
+
+  // Two nodes sharing the CPU 0 so pinning a thread is always valid
+  auto topology = std::make_shared<Topology>(std::vector<std::vector<int>>{{0}, {0}});
+  ASSERT_EQ(topology->nbNodes(), (size_t) 2);
+  std::vector<size_t> pinnedNodes;
+  std::thread([&topology, &pinnedNodes]() {
+    pinnedNodes.push_back(topology->pinCurrentThread());
+    pinnedNodes.push_back(topology->pinCurrentThread());
+  }).join();
+  ASSERT_EQ(pinnedNodes, std::vector<size_t>({0, 1}));
+
+  fl::internal::Cache<int> cache({4, 4}, 4, {8, 8}, nullptr, topology);
+  ASSERT_EQ(cache.nbPartitions(), (size_t) 2);
+  ASSERT_EQ(cache.pool(0).size(), (size_t) 2);
+  ASSERT_EQ(cache.pool(1).size(), (size_t) 2);
+
+  // Load the tiles of the first row, each tile is homed by its index
+  for (size_t col = 0; col < 4; ++col) {
+    auto tile = cache.lockedTile({0, col});
+    ASSERT_EQ(tile->partition(), col % 2);
+    tile->newTile(false);
+    tile->releaseSemaphore();
+  }
+  ASSERT_TRUE(cache.pool(0).empty());
+  ASSERT_TRUE(cache.pool(1).empty());
+
+  // A miss recycles the least recently used tile of its partition
+  auto tile = cache.lockedTile({1, 1});
+  ASSERT_EQ(tile->partition(), (size_t) 1);
+  ASSERT_EQ(cache.mapCache().at(1), nullptr);
+  ASSERT_NE(cache.mapCache().at(3), nullptr);
+  ASSERT_NE(cache.mapCache().at(0), nullptr);
+  tile->releaseSemaphore();
+
+  // The only evictable tile of the partition is in use: a miss waits for it without locking the cache
+  fl::internal::Cache<int> pinnedCache({4, 4}, 4, {8, 8}, nullptr, topology, nullptr, nullptr, 2);
+  ASSERT_TRUE(pinnedCache.pin({0, 0}));
+  std::shared_ptr<fl::internal::CachedTile<int>> heldTile = nullptr;
+  for (size_t col = 0; col < 4; ++col) {
+    auto loadedTile = pinnedCache.lockedTile({0, col});
+    loadedTile->newTile(false);
+    if (col == 2) { heldTile = loadedTile; }
+    else { loadedTile->releaseSemaphore(); }
+  }
+  std::atomic<bool> missServed = false;
+  std::thread miss([&pinnedCache, &missServed]() {
+    auto missedTile = pinnedCache.lockedTile({1, 0});
+    missServed = true;
+    missedTile->newTile(false);
+    missedTile->releaseSemaphore();
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(missServed);
+  auto otherPartitionTile = pinnedCache.lockedTile({0, 1});
+  otherPartitionTile->releaseSemaphore();
+  heldTile->releaseSemaphore();
+  miss.join();
+  ASSERT_TRUE(missServed);
+  ASSERT_NE(pinnedCache.mapCache().at(0), nullptr);
+  ASSERT_EQ(pinnedCache.mapCache().at(2), nullptr);
+  ASSERT_NE(pinnedCache.mapCache().at(4), nullptr);
+
+  // A single node topology does not partition the cache
+  fl::internal::Cache<int> singleNodeCache({4, 4}, 4, {8, 8}, nullptr, std::make_shared<Topology>(
+      std::vector<std::vector<int>>{{0}}));
+  ASSERT_EQ(singleNodeCache.nbPartitions(), (size_t) 1);
+  ASSERT_EQ(singleNodeCache.pool().size(), (size_t) 4);
+}
+
+template<class DataType>
+void testTileCodec(std::vector<DataType> const &data, bool compressible) {
+  auto block = fl::internal::TileCodec<DataType>::compress(data.data(), data.size());
+  if (compressible) { ASSERT_LT(block.size(), data.size() * sizeof(DataType) / 4); }
+  else { ASSERT_LE(block.size(), data.size() * sizeof(DataType) + 1); }
+  std::vector<DataType> decompressed(data.size());
+  fl::internal::TileCodec<DataType>::decompress(block, decompressed.data(), decompressed.size());
+  ASSERT_EQ(decompressed, data);
+}
+
+void testCompressedCache() {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> distribution(0, 1 << 30);
+
+  // Sparse data
+  std::vector<uint16_t> sparse(64 * 64, 0);
+  for (size_t pos = 0; pos < sparse.size(); pos += 37) { sparse.at(pos) = (uint16_t) (pos % 4096); }
+  testTileCodec(sparse, true);
+  // Smooth data, only the low order bytes vary
+  std::vector<float> smooth(32 * 32 * 4);
+  std::iota(smooth.begin(), smooth.end(), 1000.f);
+  testTileCodec(std::vector<double>(smooth.cbegin(), smooth.cend()), true);
+  testTileCodec(std::vector<int>(10000, 7), true);
+  // Random data, stored
+  std::vector<int> random(5000);
+  std::generate(random.begin(), random.end(), [&]() { return distribution(gen); });
+  testTileCodec(random, false);
+  testTileCodec(std::vector<uint8_t>{}, false);
+  testTileCodec(std::vector<uint8_t>{1, 2, 3}, false);
+
+  // Corrupted block
+  auto block = fl::internal::TileCodec<int>::compress(std::vector<int>(1000, 3).data(), 1000);
+  block.resize(block.size() - 1);
+  std::vector<int> decompressed(1000);
+  ASSERT_THROW(fl::internal::TileCodec<int>::decompress(block, decompressed.data(), 1000), std::runtime_error);
+
+  // Capacity and exclusive tiers
+  fl::internal::CompressedCache<int> compressedCache(2 * (random.size() * sizeof(int) + 1));
+  compressedCache.store(0, random.data(), random.size());
+  compressedCache.store(1, random.data(), random.size());
+  compressedCache.store(2, random.data(), random.size());
+  ASSERT_EQ(compressedCache.nbTiles(), (size_t) 2);
+  std::vector<int> restored(random.size());
+  ASSERT_FALSE(compressedCache.load(0, restored.data(), restored.size()));
+  ASSERT_TRUE(compressedCache.load(1, restored.data(), restored.size()));
+  ASSERT_EQ(restored, random);
+  ASSERT_FALSE(compressedCache.load(1, restored.data(), restored.size()));
+  ASSERT_EQ(compressedCache.nbTiles(), (size_t) 1);
+  ASSERT_EQ(compressedCache.hit(), (size_t) 1);
+  ASSERT_EQ(compressedCache.miss(), (size_t) 2);
+
+  // Evicted tiles go to the compressed tier and are restored from it
+  fl::internal::Cache<int> cache({4}, 1, {100}, nullptr, nullptr,
+                                 std::make_shared<fl::internal::CompressedCache<int>>(1024 * 1024));
+  std::vector<size_t> const indices{0, 1, 0};
+  std::vector<bool> const restoredTiles{false, false, true};
+  for (size_t request = 0; request < indices.size(); ++request) {
+    int const value = (int) indices.at(request) + 1;
+    auto tile = cache.lockedTile({indices.at(request)});
+    ASSERT_TRUE(tile->newTile());
+    tile->newTile(false);
+    tile->lock();
+    bool const tileRestored = cache.restoreTile(tile);
+    ASSERT_EQ(tileRestored, restoredTiles.at(request));
+    if (!tileRestored) { std::fill(tile->data()->begin(), tile->data()->end(), value); }
+    ASSERT_EQ(tile->data()->back(), value);
+    tile->unlock();
+    tile->releaseSemaphore();
+  }
+  ASSERT_EQ(cache.compressedCache()->hit(), (size_t) 1);
+}
+
+void testDiskTileCache() {
+  auto directory = std::filesystem::temp_directory_path() / ("fast_loader_test_" + std::to_string(getpid()));
+  std::filesystem::create_directories(directory);
+  std::vector<int> tile(1000), restored(1000);
+  {
+    // Room for 2 tiles
+    fl::internal::DiskTileCache<int> diskCache(directory, "identity", tile.size(), 2 * tile.size() * sizeof(int));
+    ASSERT_TRUE(diskCache.enabled());
+    for (size_t index : {3, 5}) {
+      std::fill(tile.begin(), tile.end(), (int) index);
+      diskCache.store(index, tile.data(), tile.size());
+    }
+    ASSERT_TRUE(diskCache.load(3, restored.data(), restored.size()));
+    ASSERT_EQ(restored, std::vector<int>(1000, 3));
+    // The tile 5 is the least recently used
+    std::fill(tile.begin(), tile.end(), 7);
+    diskCache.store(7, tile.data(), tile.size());
+    ASSERT_FALSE(diskCache.load(5, restored.data(), restored.size()));
+    ASSERT_EQ(diskCache.nbTiles(), (size_t) 2);
+
+    // The slab file is locked by its user
+    fl::internal::DiskTileCache<int> lockedDiskCache(directory, "identity", tile.size(), 2 * tile.size() * sizeof(int));
+    ASSERT_FALSE(lockedDiskCache.enabled());
+  }
+  {
+    // The tiles are kept across runs
+    fl::internal::DiskTileCache<int> diskCache(directory, "identity", tile.size(), 2 * tile.size() * sizeof(int));
+    ASSERT_EQ(diskCache.nbTiles(), (size_t) 2);
+    ASSERT_TRUE(diskCache.load(7, restored.data(), restored.size()));
+    ASSERT_EQ(restored, std::vector<int>(1000, 7));
+    ASSERT_TRUE(diskCache.load(3, restored.data(), restored.size()));
+    ASSERT_EQ(restored, std::vector<int>(1000, 3));
+  }
+  {
+    // A different geometry resets the slab file
+    fl::internal::DiskTileCache<int> diskCache(directory, "identity", tile.size(), 4 * tile.size() * sizeof(int));
+    ASSERT_EQ(diskCache.nbTiles(), (size_t) 0);
+  }
+  {
+    // Concurrent reads and writes, copied outside the lock, never return a torn or replaced tile
+    size_t const nbElements = 1000;
+    fl::internal::DiskTileCache<int> diskCache(directory, "concurrent", nbElements, 4 * nbElements * sizeof(int));
+    std::atomic<size_t> nbTornTiles{0};
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < 4; ++thread) {
+      threads.emplace_back([&diskCache, &nbTornTiles, nbElements, thread]() {
+        std::vector<int> written(nbElements), read(nbElements);
+        for (size_t iteration = 0; iteration < 500; ++iteration) {
+          size_t const index = (thread * 7 + iteration) % 12;
+          std::fill(written.begin(), written.end(), (int) index);
+          diskCache.store(index, written.data(), written.size());
+          if (diskCache.load((index + 5) % 12, read.data(), read.size())
+              && read != std::vector<int>(nbElements, (int) ((index + 5) % 12))) { ++nbTornTiles; }
+        }
+      });
+    }
+    for (auto &thread : threads) { thread.join(); }
+    ASSERT_EQ(nbTornTiles.load(), (size_t) 0);
+    ASSERT_EQ(diskCache.nbTiles(), (size_t) 4);
+  }
+  std::filesystem::remove_all(directory);
+}
+
+void testPinnedCache() {
+  // 16 tiles, 4 in cache, the pinned budget is bounded to 3 tiles
+  fl::internal::Cache<int> cache({4, 4}, 4, {2, 2}, nullptr, nullptr, nullptr, nullptr, 10);
+  ASSERT_EQ(cache.nbPinnableTiles(), (size_t) 3);
+  auto access = [&cache](std::vector<size_t> const &index) {
+    auto tile = cache.lockedTile(index);
+    tile->newTile(false);
+    tile->releaseSemaphore();
+  };
+
+  ASSERT_TRUE(cache.pin({0, 0}));
+  ASSERT_TRUE(cache.pin({0, 0}));
+  ASSERT_TRUE(cache.pin({3, 3}));
+  ASSERT_EQ(cache.nbPinnedTiles(), (size_t) 2);
+  access({0, 0});
+  access({3, 3});
+
+  // A scan does not evict the pinned tiles
+  for (size_t row = 0; row < 4; ++row) { for (size_t col = 0; col < 4; ++col) { access({row, col}); }}
+  ASSERT_NE(cache.mapCache().at(0), nullptr);
+  ASSERT_NE(cache.mapCache().at(15), nullptr);
+  ASSERT_EQ(cache.hit(), (size_t) 2);
+
+  ASSERT_TRUE(cache.pin({1, 1}));
+  ASSERT_FALSE(cache.pin({1, 2}));
+  ASSERT_FALSE(cache.isPinned({1, 2}));
+
+  // Unpinned tiles are evicted following the LRU order
+  cache.unpin({0, 0});
+  cache.unpin({1, 1});
+  ASSERT_FALSE(cache.isPinned({0, 0}));
+  ASSERT_EQ(cache.nbPinnedTiles(), (size_t) 1);
+  for (size_t col = 0; col < 4; ++col) { access({2, col}); }
+  ASSERT_EQ(cache.mapCache().at(0), nullptr);
+  ASSERT_NE(cache.mapCache().at(15), nullptr);
+}
+
+void testCacheAdmission() {
+  fl::internal::FrequencySketch sketch(4);
+  for (size_t access = 0; access < 3; ++access) { sketch.increment(42); }
+  ASSERT_GE(sketch.estimate(42), 3);
+  for (size_t access = 0; access < 20; ++access) { sketch.increment(42); }
+  ASSERT_LE(sketch.estimate(42), 15);
+
+  // 4 hot tiles accessed twice, then a scan of the 12 other tiles, returns the hot tiles still in cache
+  auto scan = [](fl::CacheAdmissionType admissionType, bool noCache) {
+    fl::internal::Cache<int> cache({1, 16}, 4, {2, 2}, nullptr, nullptr, nullptr, nullptr, 0, admissionType);
+    auto access = [&cache](size_t position, bool noCacheHint) {
+      auto tile = cache.lockedTile({0, position}, noCacheHint);
+      tile->newTile(false);
+      tile->releaseSemaphore();
+    };
+    for (size_t pass = 0; pass < 2; ++pass) { for (size_t position = 0; position < 4; ++position) { access(position, false); }}
+    for (size_t position = 4; position < 16; ++position) { access(position, noCache); }
+    EXPECT_EQ(cache.declined(), (admissionType == fl::CacheAdmissionType::TINY_LFU || noCache) ? (size_t) 12 : 0);
+    size_t nbHotTiles = 0;
+    for (size_t position = 0; position < 4; ++position) { nbHotTiles += cache.mapCache().at(position) != nullptr; }
+    return nbHotTiles;
+  };
+  // Only the least recently used hot tile is evicted, to load the first scanned tile
+  ASSERT_EQ(scan(fl::CacheAdmissionType::ALWAYS, false), (size_t) 0);
+  ASSERT_EQ(scan(fl::CacheAdmissionType::TINY_LFU, false), (size_t) 3);
+  ASSERT_EQ(scan(fl::CacheAdmissionType::ALWAYS, true), (size_t) 3);
+  ASSERT_EQ(scan(fl::CacheAdmissionType::TINY_LFU, true), (size_t) 3);
+
+  // A concurrent declined miss waits for the slot of the declined tile in use instead of evicting a hot tile
+  fl::internal::Cache<int> scanCache({1, 16}, 4, {2, 2});
+  for (size_t position = 0; position < 4; ++position) {
+    auto tile = scanCache.lockedTile({0, position});
+    tile->newTile(false);
+    tile->releaseSemaphore();
+  }
+  auto scannedTile = scanCache.lockedTile({0, 4}, true);
+  std::thread concurrentScan([&scanCache]() {
+    auto tile = scanCache.lockedTile({0, 5}, true);
+    tile->newTile(false);
+    tile->releaseSemaphore();
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  scannedTile->newTile(false);
+  scannedTile->releaseSemaphore();
+  concurrentScan.join();
+  for (size_t position = 1; position < 4; ++position) { ASSERT_NE(scanCache.mapCache().at(position), nullptr); }
+  ASSERT_EQ(scanCache.mapCache().at(4), nullptr);
+  ASSERT_NE(scanCache.mapCache().at(5), nullptr);
+}
+
 #endif //FAST_LOADER_TEST_CACHE_H
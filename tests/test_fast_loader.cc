@@ -25,6 +25,9 @@
 
 TEST(TEST_FL, TEST_CACHE) {
   ASSERT_NO_THROW(testCache());
+  ASSERT_NO_THROW(testNumaCache());
+  ASSERT_NO_THROW(testCompressedCache());
+  ASSERT_NO_THROW(testDiskTileCache());
 }
 
 TEST(TEST_FL, TEST_FAIL_TL){
@@ -43,6 +46,21 @@ TEST(TEST_FL, TEST_REQUEST) {
   ASSERT_NO_THROW(basicRequest());
   ASSERT_NO_THROW(testOrdering());
   ASSERT_NO_THROW(testFillingConstant());
+  ASSERT_NO_THROW(testTileRequestPool());
+}
+
+TEST(TEST_FL, TEST_TILE_ALIAS) {
+  ASSERT_NO_THROW(testTileAliasView());
+  ASSERT_THROW(testTileAliasViewOptions(), std::runtime_error);
+}
+
+TEST(TEST_FL, TEST_REGION) {
+  ASSERT_NO_THROW(testRegionRequest());
+}
+
+TEST(TEST_FL, TEST_BATCH) {
+  ASSERT_NO_THROW(testBatchedView());
+  ASSERT_THROW(testBatchedViewOptions(), std::runtime_error);
 }
 
 TEST(TEST_FL, TEST_BASE){
@@ -50,6 +68,83 @@ TEST(TEST_FL, TEST_BASE){
   ASSERT_NO_THROW(testViewWithRadiusConstant());
 }
 
+TEST(TEST_FL, TEST_BUFFER_ALLOCATION) {
+  ASSERT_NO_THROW(testBufferAllocation());
+  ASSERT_THROW(testBufferAllocationOptions(), std::runtime_error);
+}
+
+TEST(TEST_FL, TEST_CACHE_TIERS) {
+  ASSERT_NO_THROW(testCompressedCacheTier());
+  ASSERT_NO_THROW(testDiskCacheTier());
+  ASSERT_NO_THROW(testWarmStart());
+}
+
+TEST(TEST_FL, TEST_PINNED_TILES) {
+  ASSERT_NO_THROW(testPinnedCache());
+  ASSERT_NO_THROW(testPinnedTiles());
+}
+
+TEST(TEST_FL, TEST_CACHE_ADMISSION) {
+  ASSERT_NO_THROW(testCacheAdmission());
+  // The interactive tiles are loaded again after the scan only if every missed tile is admitted, with TinyLFU they
+  // can be evicted by the scan but are admitted again when the scan reaches them
+  ASSERT_NO_THROW(testScanResistance(fl::CacheAdmissionType::ALWAYS, false, 20));
+  ASSERT_NO_THROW(testScanResistance(fl::CacheAdmissionType::TINY_LFU, false, 18));
+  ASSERT_NO_THROW(testScanResistance(fl::CacheAdmissionType::ALWAYS, true, 16));
+  ASSERT_NO_THROW(testAdaptiveScanResistance(false));
+  ASSERT_NO_THROW(testAdaptiveScanResistance(true));
+}
+
+TEST(TEST_FL, TEST_REQUEST_PRIORITY) {
+  ASSERT_NO_THROW(testRequestPriority(false));
+  ASSERT_NO_THROW(testRequestPriority(true));
+}
+
+TEST(TEST_FL, TEST_CANCEL_REQUESTS) {
+  ASSERT_NO_THROW(testCancelRequests(0, false));
+  ASSERT_NO_THROW(testCancelRequests(0, true));
+  ASSERT_NO_THROW(testCancelRequests(2, false));
+  ASSERT_NO_THROW(testCancelRequests(2, true));
+  ASSERT_NO_THROW(testCancelDeliveryRace());
+}
+
+TEST(TEST_FL, TEST_COALESCE_REQUESTS) {
+  ASSERT_NO_THROW(testCoalesceRequests());
+}
+
+TEST(TEST_FL, TEST_ELASTIC_VIEW_POOL) {
+  ASSERT_NO_THROW(testElasticViewPool());
+}
+
+TEST(TEST_FL, TEST_BOUNDED_REQUEST_ALL_VIEWS) {
+  ASSERT_NO_THROW(testBoundedRequestAllViews(false));
+  ASSERT_NO_THROW(testBoundedRequestAllViews(true));
+}
+
+TEST(TEST_FL, TEST_LEVEL_THREADS) {
+  ASSERT_NO_THROW(testLevelThreads(false));
+  ASSERT_NO_THROW(testLevelThreads(true));
+  ASSERT_NO_THROW(testLevelThreadsCacheHits());
+}
+
+TEST(TEST_FL, TEST_COPY_IN_TILE_LOADER) {
+  ASSERT_NO_THROW(testCopyInTileLoader());
+}
+
+TEST(TEST_FL, TEST_AUTO_TUNE_LOADER_THREADS) {
+  ASSERT_NO_THROW(testAutoTuneLoaderThreads());
+  ASSERT_NO_THROW(testLoaderAutoTunerSettles());
+}
+
+TEST(TEST_FL, TEST_VIRTUAL_LEVELS) {
+  ASSERT_NO_THROW(testVirtualLevels());
+}
+
+TEST(TEST_FL, TEST_PROGRESSIVE) {
+  ASSERT_NO_THROW(testProgressive());
+}
+
 TEST(TEST_FL, TEST_ADAPTIVE){
   ASSERT_NO_THROW(testAdaptiveFL());
+  ASSERT_NO_THROW(testAdaptiveSelectedTileDimensions());
 }
\ No newline at end of file
@@ -21,6 +21,8 @@
 
 #include <gtest/gtest.h>
 #include <array>
+#include <cstdlib>
+#include <new>
 #include "tile_loaders/virtual_file_tile_loader.h"
 
 void basicRequest() {
@@ -1286,4 +1288,294 @@ void testFillingConstant() {
 
 }
 
+void testTileAliasView() {
+  std::vector<size_t> fullDimension{9, 8, 7}, tileDimension{3, 3, 3};
+  using AliasLoader = TypedVirtualFileTileLoader<fl::TileAliasView<int>>;
+  auto tl = std::make_shared<AliasLoader>(2, fullDimension, tileDimension);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::TileAliasView<int>>>(tl);
+  options->radius(0);
+  options->viewAvailable({4});
+  auto fl = fl::FastLoaderGraph<fl::TileAliasView<int>>(std::move(options));
+  fl.executeGraph();
+  fl.requestAllViews(0);
+  fl.finishRequestingViews();
+
+  size_t numberReceived = 0;
+  while (auto viewVariant = fl.getBlockingResult()) {
+    auto view = std::get<std::shared_ptr<fl::TileAliasView<int>>>(*viewVariant);
+    ASSERT_TRUE(view->viewDims() == tileDimension);
+    auto realDataDimension = view->viewRealDataDims();
+    auto startPosition = view->globalPositionCentralTile();
+    for (size_t dim0 = 0; dim0 < realDataDimension.at(0); ++dim0) {
+      for (size_t dim1 = 0; dim1 < realDataDimension.at(1); ++dim1) {
+        for (size_t dim2 = 0; dim2 < realDataDimension.at(2); ++dim2) {
+          ASSERT_EQ(view->viewOrigin()[dim0 * 9 + dim1 * 3 + dim2],
+                    (int) ((startPosition.at(0) + dim0) * 100
+                        + (startPosition.at(1) + dim1) * 10
+                        + (startPosition.at(2) + dim2)));
+        }
+      }
+    }
+    ++numberReceived;
+    view->returnToMemoryManager();
+  }
+  fl.waitForTermination();
+  ASSERT_EQ(numberReceived, (size_t) 27);
+
+  // The same tile requested twice is served from the same cached buffer
+  auto tlSameTile = std::make_shared<AliasLoader>(1, fullDimension, tileDimension);
+  auto optionsSameTile = std::make_unique<fl::FastLoaderConfiguration<fl::TileAliasView<int>>>(tlSameTile);
+  optionsSameTile->viewAvailable({3});
+  auto flSameTile = fl::FastLoaderGraph<fl::TileAliasView<int>>(std::move(optionsSameTile));
+  flSameTile.executeGraph();
+  flSameTile.requestView({1, 1, 1});
+  auto first = std::get<std::shared_ptr<fl::TileAliasView<int>>>(*flSameTile.getBlockingResult());
+  int *firstOrigin = first->viewOrigin();
+  auto copy = first->deepCopy();
+  first->returnToMemoryManager();
+  flSameTile.requestView({1, 1, 1});
+  auto second = std::get<std::shared_ptr<fl::TileAliasView<int>>>(*flSameTile.getBlockingResult());
+  ASSERT_EQ(firstOrigin, second->viewOrigin());
+  ASSERT_NE(copy->viewOrigin(), second->viewOrigin());
+  ASSERT_TRUE(std::equal(second->viewOrigin(), second->viewOrigin() + 27, copy->viewOrigin()));
+  // An aliased tile is requested again while its alias is held
+  flSameTile.requestView({1, 1, 1});
+  auto third = std::get<std::shared_ptr<fl::TileAliasView<int>>>(*flSameTile.getBlockingResult());
+  ASSERT_EQ(firstOrigin, third->viewOrigin());
+  ASSERT_TRUE(std::equal(third->viewOrigin(), third->viewOrigin() + 27, copy->viewOrigin()));
+  // Other tiles are still served while the aliases are held
+  flSameTile.requestView({2, 2, 2});
+  auto other = std::get<std::shared_ptr<fl::TileAliasView<int>>>(*flSameTile.getBlockingResult());
+  ASSERT_EQ(other->viewOrigin()[0], 666);
+  second->returnToMemoryManager();
+  third->returnToMemoryManager();
+  other->returnToMemoryManager();
+  flSameTile.finishRequestingViews();
+  flSameTile.waitForTermination();
+
+  // The padding of an edge tile is filled once in the shared cached tile, not by each alias
+  struct CountingConstantBorderCreator : fl::internal::ConstantBorderCreator<fl::TileAliasView<int>> {
+    std::atomic<size_t> nbFills{0};
+    CountingConstantBorderCreator() : fl::internal::ConstantBorderCreator<fl::TileAliasView<int>>(-1) {}
+    void fillBorderWithExistingValues(std::shared_ptr<fl::TileAliasView<int>> const &view) override {
+      ++nbFills;
+      fl::internal::ConstantBorderCreator<fl::TileAliasView<int>>::fillBorderWithExistingValues(view);
+    }
+  };
+  auto borderCreator = std::make_shared<CountingConstantBorderCreator>();
+  auto tlEdge = std::make_shared<AliasLoader>(1, fullDimension, tileDimension);
+  auto optionsEdge = std::make_unique<fl::FastLoaderConfiguration<fl::TileAliasView<int>>>(tlEdge);
+  optionsEdge->viewAvailable({2});
+  optionsEdge->borderCreatorCustom(borderCreator);
+  auto flEdge = fl::FastLoaderGraph<fl::TileAliasView<int>>(std::move(optionsEdge));
+  flEdge.executeGraph();
+  flEdge.requestView({2, 2, 2});
+  flEdge.requestView({2, 2, 2});
+  auto firstEdge = std::get<std::shared_ptr<fl::TileAliasView<int>>>(*flEdge.getBlockingResult());
+  auto secondEdge = std::get<std::shared_ptr<fl::TileAliasView<int>>>(*flEdge.getBlockingResult());
+  bool const sameBuffer = firstEdge->viewOrigin() == secondEdge->viewOrigin();
+  bool edgeValid = true;
+  for (auto const &edge : {firstEdge, secondEdge}) {
+    edgeValid &= edge->viewRealDataDims() == std::vector<size_t>({3, 2, 1});
+    for (size_t dim0 = 0; dim0 < 3; ++dim0) {
+      for (size_t dim1 = 0; dim1 < 3; ++dim1) {
+        for (size_t dim2 = 0; dim2 < 3; ++dim2) {
+          int const expected = dim1 < 2 && dim2 < 1 ? (int) ((6 + dim0) * 100 + (6 + dim1) * 10 + 6) : -1;
+          edgeValid &= edge->viewOrigin()[dim0 * 9 + dim1 * 3 + dim2] == expected;
+        }
+      }
+    }
+  }
+  firstEdge->returnToMemoryManager();
+  secondEdge->returnToMemoryManager();
+  flEdge.finishRequestingViews();
+  flEdge.waitForTermination();
+  ASSERT_TRUE(sameBuffer);
+  ASSERT_TRUE(edgeValid);
+  ASSERT_EQ(borderCreator->nbFills.load(), (size_t) 1);
+}
+
+void testTileAliasViewOptions() {
+  std::vector<size_t> fullDimension{9, 9, 9}, tileDimension{3, 3, 3};
+  auto tl = std::make_shared<TypedVirtualFileTileLoader<fl::TileAliasView<int>>>(1, fullDimension, tileDimension);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::TileAliasView<int>>>(tl);
+  options->radius(1);
+  fl::FastLoaderGraph<fl::TileAliasView<int>>{std::move(options)};
+}
+
+template<class GraphType>
+concept RegionRequestable = requires(GraphType &graph, std::vector<size_t> const &position) {
+  graph.requestRegion(position, position);
+};
+
+void testRegionRequest() {
+  std::vector<size_t> fullDimension{9, 9, 9}, tileDimension{2, 3, 4};
+  auto tl = std::make_shared<VirtualFileTileLoader>(2, fullDimension, tileDimension);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+  options->radius(1);
+  options->ordered(true);
+  options->viewAvailable({1});
+  options->borderCreatorConstant(-1);
+  // The region buffers are freed when the views are recycled
+  ASSERT_THROW(options->regionBufferCapacityMB({0, 0}), std::runtime_error);
+  options->regionBufferCapacityMB({0});
+  auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+  fl.executeGraph();
+
+  auto checkRegion = [&fullDimension](std::shared_ptr<fl::DefaultView<int>> const &view,
+                                      std::vector<size_t> const &origin, std::vector<size_t> const &extent) {
+    ASSERT_TRUE(view->isRegion());
+    ASSERT_TRUE(view->regionOrigin() == origin);
+    ASSERT_TRUE(view->viewDims() == extent);
+    for (size_t dim0 = 0; dim0 < extent.at(0); ++dim0) {
+      for (size_t dim1 = 0; dim1 < extent.at(1); ++dim1) {
+        for (size_t dim2 = 0; dim2 < extent.at(2); ++dim2) {
+          size_t x = origin.at(0) + dim0, y = origin.at(1) + dim1, z = origin.at(2) + dim2;
+          int expected = x < fullDimension.at(0) && y < fullDimension.at(1) && z < fullDimension.at(2)
+                         ? (int) (100 * x + 10 * y + z) : -1;
+          ASSERT_EQ(view->viewOrigin()[(dim0 * extent.at(1) + dim1) * extent.at(2) + dim2], expected);
+        }
+      }
+    }
+  };
+
+  std::vector<std::pair<std::vector<size_t>, std::vector<size_t>>> const regions{
+      {{1, 2, 3}, {5, 4, 3}},
+      {{0, 0, 0}, {9, 9, 9}},
+      {{7, 6, 5}, {4, 5, 6}},
+      {{4, 4, 4}, {1, 1, 1}}
+  };
+  for (auto const &[origin, extent] : regions) {
+    fl.requestRegion(origin, extent);
+    auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*fl.getBlockingResult());
+    checkRegion(view, origin, extent);
+    view->returnToMemoryManager();
+  }
+
+  // A tile aligned view after regions is still correct
+  fl.requestView({1, 1, 1});
+  auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*fl.getBlockingResult());
+  ASSERT_FALSE(view->isRegion());
+  ASSERT_TRUE(view->viewDims() == std::vector<size_t>({4, 5, 6}));
+  ASSERT_EQ(view->originCentralTile()[0], 234);
+  view->returnToMemoryManager();
+
+  ASSERT_THROW(fl.requestRegion({9, 0, 0}, {1, 1, 1}), std::runtime_error);
+  ASSERT_THROW(fl.requestRegion({0, 0}, {1, 1}), std::runtime_error);
+  ASSERT_THROW(fl.requestRegion({0, 0, 0}, {1, 0, 1}), std::runtime_error);
+
+  fl.finishRequestingViews();
+  fl.waitForTermination();
+
+  // The views not owning their buffer can not be requested as a region
+  static_assert(RegionRequestable<fl::FastLoaderGraph<fl::DefaultView<int>>>);
+  static_assert(!RegionRequestable<fl::FastLoaderGraph<fl::TileAliasView<int>>>);
+  static_assert(!RegionRequestable<fl::FastLoaderGraph<fl::BatchedView<int>>>);
+
+  // A recycled view keeps its region buffer up to the capacity
+  fl::internal::DefaultViewData<int> viewData(8, 1);
+  viewData.reserve(100);
+  ASSERT_EQ(viewData.capacity(), (size_t) 100);
+  viewData.shrinkBuffer(200);
+  ASSERT_EQ(viewData.capacity(), (size_t) 100);
+  viewData.shrinkBuffer(0);
+  ASSERT_EQ(viewData.capacity(), (size_t) 8);
+}
+
+void testBatchedView() {
+  std::vector<size_t> fullDimension{8, 8, 8}, tileDimension{2, 2, 2};
+  fl::internal::NaiveTraversal traversal{};
+  auto truth = traversal.traversal({4, 4, 4});
+  for (size_t batchSize : {4, 5}) {
+    using BatchLoader = TypedVirtualFileTileLoader<fl::BatchedView<int>>;
+    auto tl = std::make_shared<BatchLoader>(2, fullDimension, tileDimension);
+    auto options = std::make_unique<fl::FastLoaderConfiguration<fl::BatchedView<int>>>(tl);
+    options->radius(0);
+    options->ordered(true);
+    options->viewAvailable({8});
+    options->batch(batchSize);
+    auto fl = fl::FastLoaderGraph<fl::BatchedView<int>>(std::move(options));
+    fl.executeGraph();
+    fl.requestAllViews(0);
+    fl.finishRequestingViews();
+
+    size_t numberReceived = 0;
+    while (auto batch = fl.getBlockingBatch()) {
+      ASSERT_EQ(batch->size(), std::min(batchSize, (size_t) 64 - numberReceived));
+      for (size_t slot = 0; slot < batch->size(); ++slot) {
+        auto const &view = batch->views().at(slot);
+        ASSERT_EQ(view->batchIndex(), slot);
+        ASSERT_EQ(view->viewOrigin(), batch->data() + slot * 8);
+        ASSERT_TRUE(view->indexCentralTile() == truth.at(numberReceived));
+        auto start = view->globalPositionCentralTile();
+        ASSERT_EQ(batch->data()[slot * 8 + 7],
+                  (int) (100 * (start.at(0) + 1) + 10 * (start.at(1) + 1) + start.at(2) + 1));
+        ++numberReceived;
+      }
+      batch->returnToMemoryManager();
+    }
+    fl.waitForTermination();
+    ASSERT_EQ(numberReceived, (size_t) 64);
+  }
+}
+
+void testBatchedViewOptions() {
+  std::vector<size_t> fullDimension{8, 8, 8}, tileDimension{2, 2, 2};
+  auto tl = std::make_shared<TypedVirtualFileTileLoader<fl::BatchedView<int>>>(1, fullDimension, tileDimension);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::BatchedView<int>>>(tl);
+  options->viewAvailable({2});
+  options->batch(4);
+  fl::FastLoaderGraph<fl::BatchedView<int>>{std::move(options)};
+}
+
+/// @brief Number of allocations made by the thread with the global operator new
+thread_local size_t nbHeapAllocations = 0;
+
+void *operator new(size_t size) {
+  ++nbHeapAllocations;
+  if (void *ptr = std::malloc(size == 0 ? 1 : size)) { return ptr; }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+
+void testTileRequestPool() {
+  // Requests made for a 3D view with a radius of 1, 27 tiles with 2 copies each
+  auto pool = std::make_shared<fl::internal::TileRequestPool>();
+  auto view = std::make_shared<fl::DefaultView<int>>();
+  std::vector<std::vector<size_t>> indices;
+  for (size_t i = 0; i < 27; ++i) { indices.push_back({i / 9, (i / 3) % 3, i % 3}); }
+  std::vector<std::shared_ptr<fl::internal::TileRequest<fl::DefaultView<int>>>> requests;
+  requests.reserve(indices.size());
+  auto createRequests = [&pool, &view, &indices, &requests]() {
+    for (auto const &index : indices) {
+      auto request = pool->make<fl::internal::TileRequest<fl::DefaultView<int>>>(index, view);
+      request->addCopy(fl::internal::CopyVolume({0, 0, 0}, index, {1, 1, 1}));
+      request->addCopy(fl::internal::CopyVolume({1, 1, 1}, index, {1, 1, 1}));
+      requests.push_back(std::move(request));
+    }
+    requests.clear();
+  };
+
+  createRequests();
+  size_t const nbBlocksFirstView = pool->nbBlocksAllocated();
+  ASSERT_EQ(nbBlocksFirstView, (size_t) 27 * 3);
+  // The requests, their copies and their coordinates do not hit the heap once the pool is filled
+  size_t const nbHeapAllocationsFirstView = nbHeapAllocations;
+  for (size_t viewId = 0; viewId < 10; ++viewId) { createRequests(); }
+  ASSERT_EQ(nbHeapAllocations, nbHeapAllocationsFirstView);
+  ASSERT_EQ(pool->nbBlocksAllocated(), nbBlocksFirstView);
+  ASSERT_EQ(pool->nbBlocksRecycled(), 10 * nbBlocksFirstView);
+
+  // The coordinates past the inline capacity are stored on the heap
+  std::vector<size_t> const largeIndex(16, 1);
+  size_t const nbHeapAllocationsLarge = nbHeapAllocations;
+  fl::internal::SmallVector<size_t> const large(largeIndex);
+  ASSERT_EQ(nbHeapAllocations, nbHeapAllocationsLarge + 1);
+  ASSERT_TRUE(std::equal(large.cbegin(), large.cend(), largeIndex.cbegin(), largeIndex.cend()));
+  ASSERT_THROW((void) large.at(16), std::out_of_range);
+}
+
 #endif //FAST_LOADER_TEST_REQUESTS_H
@@ -215,4 +215,1082 @@ void testViewWithRadiusConstant() {
   }
 }
 
+void testVirtualLevels() {
+  std::vector<size_t> const fullDimension{9, 9, 7}, tileDimension{2, 3, 2};
+  std::vector<bool> const downsampledDimensions{true, true, false};
+  for (auto downsamplingType : {fl::DownsamplingType::MEAN, fl::DownsamplingType::MAX, fl::DownsamplingType::MODE}) {
+    // Ground truth per level, computed from the level below
+    std::vector<std::vector<size_t>> fullDimensionPerLevel{fullDimension};
+    std::vector<std::vector<int>> truthPerLevel(1);
+    for (size_t x = 0; x < 9; ++x) {
+      for (size_t y = 0; y < 9; ++y) {
+        for (size_t z = 0; z < 7; ++z) { truthPerLevel.back().push_back((int) (100 * x + 10 * y + z)); }
+      }
+    }
+    for (size_t level = 1; level < 3; ++level) {
+      auto const &src = fullDimensionPerLevel.back();
+      std::vector<size_t> dst{(src.at(0) + 1) / 2, (src.at(1) + 1) / 2, src.at(2)};
+      std::vector<int> truth;
+      for (size_t x = 0; x < dst.at(0); ++x) {
+        for (size_t y = 0; y < dst.at(1); ++y) {
+          for (size_t z = 0; z < dst.at(2); ++z) {
+            std::vector<int> window;
+            for (size_t sx = 2 * x; sx < std::min(2 * x + 2, src.at(0)); ++sx) {
+              for (size_t sy = 2 * y; sy < std::min(2 * y + 2, src.at(1)); ++sy) {
+                window.push_back(truthPerLevel.back().at((sx * src.at(1) + sy) * src.at(2) + z));
+              }
+            }
+            switch (downsamplingType) {
+              case fl::DownsamplingType::MEAN:
+                truth.push_back((int) std::round(
+                    std::accumulate(window.cbegin(), window.cend(), 0.) / (double) window.size()));
+                break;
+              case fl::DownsamplingType::MAX:truth.push_back(*std::max_element(window.cbegin(), window.cend()));
+                break;
+              case fl::DownsamplingType::MODE:truth.push_back(*std::min_element(window.cbegin(), window.cend()));
+                break;
+            }
+          }
+        }
+      }
+      fullDimensionPerLevel.push_back(dst);
+      truthPerLevel.push_back(truth);
+    }
+
+    auto tl = std::make_shared<VirtualFileTileLoader>(2, fullDimension, tileDimension);
+    auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+    options->virtualLevels(2, downsamplingType, downsampledDimensions);
+    options->cacheCapacityMB({1, 1, 1});
+    auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+    ASSERT_EQ(fl.nbPyramidLevels(), (size_t) 3);
+    fl.executeGraph();
+    fl.requestAllViews(2);
+    fl.requestAllViews(1);
+    fl.finishRequestingViews();
+
+    size_t numberReceived = 0;
+    while (auto viewVariant = fl.getBlockingResult()) {
+      auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*viewVariant);
+      auto const &full = fullDimensionPerLevel.at(view->level());
+      ASSERT_TRUE(view->fullDims() == full);
+      auto realDataDimension = view->viewRealDataDims();
+      auto startPosition = view->globalPositionCentralTile();
+      for (size_t x = 0; x < realDataDimension.at(0); ++x) {
+        for (size_t y = 0; y < realDataDimension.at(1); ++y) {
+          for (size_t z = 0; z < realDataDimension.at(2); ++z) {
+            ASSERT_EQ(view->viewOrigin()[(x * tileDimension.at(1) + y) * tileDimension.at(2) + z],
+                      truthPerLevel.at(view->level()).at(
+                          ((startPosition.at(0) + x) * full.at(1) + startPosition.at(1) + y) * full.at(2)
+                              + startPosition.at(2) + z));
+          }
+        }
+      }
+      ++numberReceived;
+      view->returnToMemoryManager();
+    }
+    fl.waitForTermination();
+    ASSERT_EQ(numberReceived, (size_t) (2 * 1 * 4 + 3 * 2 * 4));
+  }
+}
+
+void testProgressive() {
+  std::vector<size_t> const fullDimension{8, 8, 8}, tileDimension{2, 2, 2};
+  auto tl = std::make_shared<VirtualFileTileLoader>(2, fullDimension, tileDimension);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+  options->virtualLevels(1, fl::DownsamplingType::MAX);
+  options->radius(1);
+  options->viewAvailable({2, 2});
+  options->progressive(true);
+  auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+  fl.executeGraph();
+
+  auto checkView = [&tileDimension](std::shared_ptr<fl::DefaultView<int>> const &view, bool preview) {
+    ASSERT_EQ(view->isPreview(), preview);
+    ASSERT_EQ(view->level(), (size_t) 0);
+    auto realDataDimension = view->tileRealDataDims();
+    auto startPosition = view->globalPositionCentralTile();
+    for (size_t x = 0; x < realDataDimension.at(0); ++x) {
+      for (size_t y = 0; y < realDataDimension.at(1); ++y) {
+        for (size_t z = 0; z < realDataDimension.at(2); ++z) {
+          size_t gx = startPosition.at(0) + x, gy = startPosition.at(1) + y, gz = startPosition.at(2) + z;
+          // The preview is the nearest value of the level 1, the maximum of a 2x2x2 window of the level 0
+          int expected = preview
+                         ? (int) (100 * (gx / 2 * 2 + 1) + 10 * (gy / 2 * 2 + 1) + gz / 2 * 2 + 1)
+                         : (int) (100 * gx + 10 * gy + gz);
+          ASSERT_EQ(view->originCentralTile()[(x * (tileDimension.at(1) + 2) + y) * (tileDimension.at(2) + 2) + z],
+                    expected);
+        }
+      }
+    }
+  };
+
+  // Nothing in cache for the level 1, no preview
+  fl.requestView({1, 2, 3}, 0);
+  auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*fl.getBlockingResult());
+  checkView(view, false);
+  view->returnToMemoryManager();
+
+  // Fill the level 1 cache
+  fl.requestAllViews(1);
+  for (size_t i = 0; i < 8; ++i) {
+    std::get<std::shared_ptr<fl::DefaultView<int>>>(*fl.getBlockingResult())->returnToMemoryManager();
+  }
+
+  // The preview comes first, then the full resolution view
+  for (std::vector<size_t> const &index : {std::vector<size_t>{1, 2, 3}, std::vector<size_t>{0, 3, 1}}) {
+    fl.requestView(index, 0);
+    view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*fl.getBlockingResult());
+    checkView(view, true);
+    view->returnToMemoryManager();
+    view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*fl.getBlockingResult());
+    checkView(view, false);
+    view->returnToMemoryManager();
+  }
+
+  fl.finishRequestingViews();
+  fl.waitForTermination();
+}
+
+class CountingBufferAllocator : public fl::internal::AlignedBufferAllocator {
+ public:
+  std::atomic<size_t> nbAllocations_{0};
+  void *allocate(size_t nbBytes) override {
+    ++nbAllocations_;
+    return fl::internal::AlignedBufferAllocator::allocate(nbBytes);
+  }
+};
+
+void testBufferAllocation(fl::BufferAllocationType bufferAllocationType,
+                          std::shared_ptr<fl::AbstractBufferAllocator> const &customBufferAllocator = nullptr) {
+  std::vector<size_t> fullDimension{9, 9, 9}, tileDimension{3, 3, 3};
+  auto tl = std::make_shared<VirtualFileTileLoader>(1, fullDimension, tileDimension);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+  options->radius(1);
+  options->viewAvailable({4});
+  if (customBufferAllocator) { options->bufferAllocatorCustom(customBufferAllocator); }
+  else { options->bufferAllocation(bufferAllocationType); }
+  auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+  fl.executeGraph();
+  fl.requestAllViews();
+  fl.finishRequestingViews();
+
+  size_t nbViews = 0;
+  while (auto viewVariant = fl.getBlockingResult()) {
+    auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*viewVariant);
+    auto index = view->indexCentralTile();
+    if (bufferAllocationType != fl::BufferAllocationType::DEFAULT) {
+      ASSERT_EQ(reinterpret_cast<uintptr_t>(view->viewOrigin()) % 64, (uintptr_t) 0);
+    }
+    ASSERT_EQ(view->originCentralTile()[0], (int) (300 * index.at(0) + 30 * index.at(1) + 3 * index.at(2)));
+    view->returnToMemoryManager();
+    ++nbViews;
+  }
+  fl.waitForTermination();
+  ASSERT_EQ(nbViews, (size_t) 27);
+}
+
+void testBufferAllocation() {
+  testBufferAllocation(fl::BufferAllocationType::DEFAULT);
+  testBufferAllocation(fl::BufferAllocationType::ALIGNED);
+  testBufferAllocation(fl::BufferAllocationType::HUGE_PAGE);
+  testBufferAllocation(fl::BufferAllocationType::EXPLICIT_HUGE_PAGE);
+
+  auto counting = std::make_shared<CountingBufferAllocator>();
+  testBufferAllocation(fl::BufferAllocationType::CUSTOM, counting);
+  // The 4 views and the 27 tiles of the cache
+  ASSERT_EQ(counting->nbAllocations_, (size_t) 31);
+
+  // The tile buffers handed to the tile loader come from the buffer allocator
+  auto alignedBufferAllocator = std::make_shared<fl::internal::AlignedBufferAllocator>();
+  for (size_t tile = 0; tile < 8; ++tile) {
+    auto cachedTile = std::make_shared<fl::internal::CachedTile<int>>(
+        std::vector<size_t>{3, 3, 3}, alignedBufferAllocator);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(cachedTile->data()->data()) % 64, (uintptr_t) 0);
+    ASSERT_EQ(cachedTile->data()->get_allocator().bufferAllocator(), alignedBufferAllocator);
+    ASSERT_EQ(cachedTile->data()->back(), 0);
+  }
+
+  // Buffers larger than a real huge page start on a huge page boundary
+  auto hugePageBufferAllocator = std::make_shared<fl::internal::HugePageBufferAllocator>();
+  size_t const hugePageSize = hugePageBufferAllocator->hugePageSize(), nbElements = 3 * hugePageSize / sizeof(int) / 2;
+  ASSERT_EQ(hugePageSize, (size_t) 1 << 21);
+  for (size_t buffer = 0; buffer < 4; ++buffer) {
+    auto data = static_cast<int *>(hugePageBufferAllocator->allocate(nbElements * sizeof(int)));
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(data) % hugePageSize, (uintptr_t) 0);
+    std::fill_n(data, nbElements, 42);
+    ASSERT_EQ(data[nbElements - 1], 42);
+    hugePageBufferAllocator->deallocate(data, nbElements * sizeof(int));
+  }
+}
+
+void testBufferAllocationOptions() {
+  std::vector<size_t> fullDimension{9, 9, 9}, tileDimension{3, 3, 3};
+  auto tl = std::make_shared<VirtualFileTileLoader>(1, fullDimension, tileDimension);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+  options->bufferAllocation(fl::BufferAllocationType::CUSTOM);
+}
+
+class CountingVirtualFileTileLoader : public VirtualFileTileLoader {
+  std::shared_ptr<std::atomic<size_t>> nbLoads_;
+
+ public:
+  CountingVirtualFileTileLoader(std::vector<size_t> const &fullDimension, std::vector<size_t> const &tileDimension,
+                                std::shared_ptr<std::atomic<size_t>> nbLoads)
+      : VirtualFileTileLoader(1, fullDimension, tileDimension), nbLoads_(std::move(nbLoads)) {}
+
+  void loadTileFromFile(std::shared_ptr<fl::TileBuffer<int>> tile, std::vector<size_t> const &index,
+                        size_t level) override {
+    ++(*nbLoads_);
+    VirtualFileTileLoader::loadTileFromFile(tile, index, level);
+  }
+
+  std::shared_ptr<fl::AbstractTileLoader<fl::DefaultView<int>>> copyTileLoader() override {
+    return std::make_shared<CountingVirtualFileTileLoader>(
+        this->fullDims(0), this->tileDims(0), nbLoads_);
+  }
+};
+
+void testCompressedCacheTier() {
+  // 1MB tiles, the cache holds 2 tiles out of 16
+  std::vector<size_t> fullDimension{2048, 2048}, tileDimension{512, 512};
+  auto nbLoads = std::make_shared<std::atomic<size_t>>(0);
+  auto tl = std::make_shared<CountingVirtualFileTileLoader>(fullDimension, tileDimension, nbLoads);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+  options->cacheCapacityMB({2});
+  options->compressedCacheCapacityMB({16});
+  auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+  fl.executeGraph();
+
+  for (size_t pass = 0; pass < 2; ++pass) {
+    for (size_t row = 0; row < 4; ++row) {
+      for (size_t col = 0; col < 4; ++col) {
+        fl.requestView({row, col});
+        auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*fl.getBlockingResult());
+        ASSERT_EQ(view->originCentralTile()[0], (int) (10 * 512 * row + 512 * col));
+        ASSERT_EQ(view->originCentralTile()[512 * 512 - 1], (int) (10 * (512 * row + 511) + 512 * col + 511));
+        view->returnToMemoryManager();
+      }
+    }
+  }
+  fl.finishRequestingViews();
+  fl.waitForTermination();
+  // The second pass is served by the compressed tier
+  ASSERT_EQ(nbLoads->load(), (size_t) 16);
+}
+
+void testDiskCacheTier() {
+  std::vector<size_t> fullDimension{64, 64}, tileDimension{16, 16};
+  auto directory = std::filesystem::temp_directory_path() / ("fast_loader_test_tier_" + std::to_string(getpid()));
+  std::filesystem::create_directories(directory);
+  auto nbLoads = std::make_shared<std::atomic<size_t>>(0);
+
+  for (size_t run = 0; run < 2; ++run) {
+    auto tl = std::make_shared<CountingVirtualFileTileLoader>(fullDimension, tileDimension, nbLoads);
+    auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+    options->diskCache(directory, {1});
+    auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+    fl.executeGraph();
+    fl.requestAllViews();
+    fl.finishRequestingViews();
+    while (auto viewVariant = fl.getBlockingResult()) {
+      auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*viewVariant);
+      auto index = view->indexCentralTile();
+      ASSERT_EQ(view->originCentralTile()[0], (int) (10 * 16 * index.at(0) + 16 * index.at(1)));
+      view->returnToMemoryManager();
+    }
+    fl.waitForTermination();
+    // The second run reads all the tiles from the disk cache
+    ASSERT_EQ(nbLoads->load(), (size_t) 16);
+  }
+  std::filesystem::remove_all(directory);
+}
+
+void testWarmStart() {
+  std::vector<size_t> fullDimension{2048, 2048}, tileDimension{512, 512};
+  auto snapshot = std::filesystem::temp_directory_path() / ("fast_loader_snapshot_" + std::to_string(getpid()));
+  std::vector<std::vector<size_t>> const indices{{0, 1}, {2, 2}, {3, 0}, {1, 3}};
+  auto nbLoads = std::make_shared<std::atomic<size_t>>(0);
+
+  auto requestViews = [&indices](auto &fl) {
+    for (auto const &index : indices) {
+      fl.requestView(index);
+      auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*fl.getBlockingResult());
+      ASSERT_EQ(view->originCentralTile()[0], (int) (10 * 512 * index.at(0) + 512 * index.at(1)));
+      view->returnToMemoryManager();
+    }
+  };
+
+  {
+    auto tl = std::make_shared<CountingVirtualFileTileLoader>(fullDimension, tileDimension, nbLoads);
+    auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+    options->cacheCapacityMB({8});
+    auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+    fl.executeGraph();
+    requestViews(fl);
+    fl.saveCacheSnapshot(snapshot);
+    fl.finishRequestingViews();
+    fl.waitForTermination();
+  }
+  ASSERT_EQ(nbLoads->load(), (size_t) 4);
+
+  // Most recently used tile first, an invalid entry is ignored
+  std::ifstream snapshotFile(snapshot);
+  std::string line;
+  std::vector<std::string> lines;
+  while (std::getline(snapshotFile, line)) { if (line.front() != '#') { lines.push_back(line); } }
+  ASSERT_EQ(lines, std::vector<std::string>({"0 1 3", "0 3 0", "0 2 2", "0 0 1"}));
+  std::ofstream(snapshot, std::ios::app) << "0 9 9\n";
+
+  {
+    auto tl = std::make_shared<CountingVirtualFileTileLoader>(fullDimension, tileDimension, nbLoads);
+    auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+    options->cacheCapacityMB({8});
+    options->warmStart(snapshot);
+    auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+    fl.executeGraph();
+    while (!fl.warmStartDone()) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+    ASSERT_EQ(fl.nbWarmStartTiles(), (size_t) 4);
+    // The views are served from the preloaded tiles
+    requestViews(fl);
+    fl.finishRequestingViews();
+    fl.waitForTermination();
+  }
+  ASSERT_EQ(nbLoads->load(), (size_t) 8);
+  std::filesystem::remove(snapshot);
+}
+
+void testPinnedTiles() {
+  // 1MB tiles, the cache holds 4 tiles out of 16, 2 of them can be pinned
+  std::vector<size_t> fullDimension{2048, 2048}, tileDimension{512, 512};
+  auto nbLoads = std::make_shared<std::atomic<size_t>>(0);
+  auto tl = std::make_shared<CountingVirtualFileTileLoader>(fullDimension, tileDimension, nbLoads);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+  options->cacheCapacityMB({4});
+  options->pinnedCapacityMB({2});
+  auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+  fl.executeGraph();
+
+  ASSERT_THROW(fl.pinTiles(1, {0, 0}, {1, 1}), std::runtime_error);
+  ASSERT_THROW(fl.pinTiles(0, {0, 0}, {5, 1}), std::runtime_error);
+  ASSERT_THROW(fl.pinTiles(0, {1, 1}, {1, 2}), std::runtime_error);
+
+  // The pinned tiles are loaded eagerly, until the budget is exhausted
+  ASSERT_EQ(fl.pinTiles(0, {0, 0}, {1, 4}), (size_t) 2);
+  ASSERT_EQ(fl.nbPinnedTiles(0), (size_t) 2);
+  ASSERT_EQ(nbLoads->load(), (size_t) 2);
+
+  auto requestView = [&fl](std::vector<size_t> const &index) {
+    fl.requestView(index);
+    auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*fl.getBlockingResult());
+    ASSERT_EQ(view->originCentralTile()[0], (int) (10 * 512 * index.at(0) + 512 * index.at(1)));
+    view->returnToMemoryManager();
+  };
+
+  // A scan does not evict the pinned tiles
+  for (size_t row = 0; row < 4; ++row) { for (size_t col = 0; col < 4; ++col) { requestView({row, col}); }}
+  ASSERT_EQ(nbLoads->load(), (size_t) 16);
+  requestView({0, 0});
+  requestView({0, 1});
+  ASSERT_EQ(nbLoads->load(), (size_t) 16);
+
+  // Unpinned tiles are evicted by the next scan
+  fl.unpinTiles(0, {0, 0}, {1, 4});
+  ASSERT_EQ(fl.nbPinnedTiles(0), (size_t) 0);
+  for (size_t row = 1; row < 4; ++row) { for (size_t col = 0; col < 4; ++col) { requestView({row, col}); }}
+  requestView({0, 0});
+  ASSERT_EQ(nbLoads->load(), (size_t) 29);
+
+  fl.finishRequestingViews();
+  fl.waitForTermination();
+}
+
+void testScanResistance(fl::CacheAdmissionType admissionType, bool noCache, size_t expectedNbLoads) {
+  // 1MB tiles, the cache holds 4 tiles out of 16
+  std::vector<size_t> fullDimension{2048, 2048}, tileDimension{512, 512};
+  auto nbLoads = std::make_shared<std::atomic<size_t>>(0);
+  auto tl = std::make_shared<CountingVirtualFileTileLoader>(fullDimension, tileDimension, nbLoads);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+  options->cacheCapacityMB({4});
+  options->cacheAdmission(admissionType);
+  auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+  fl.executeGraph();
+
+  auto getView = [&fl]() {
+    auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*fl.getBlockingResult());
+    auto index = view->indexCentralTile();
+    ASSERT_EQ(view->originCentralTile()[0], (int) (10 * 512 * index.at(0) + 512 * index.at(1)));
+    view->returnToMemoryManager();
+  };
+  auto interactive = [&fl, &getView]() {
+    for (size_t pass = 0; pass < 2; ++pass) {
+      fl.requestView({1, 1});
+      getView();
+      fl.requestView({2, 2});
+      getView();
+    }
+  };
+
+  interactive();
+  fl.requestAllViews(0, noCache);
+  for (size_t view = 0; view < 16; ++view) { getView(); }
+  interactive();
+
+  fl.finishRequestingViews();
+  fl.waitForTermination();
+  ASSERT_EQ(nbLoads->load(), expectedNbLoads);
+}
+
+void testAdaptiveScanResistance(bool noCache) {
+  // 1MB physical tiles, the logical tiles are not aligned on them, the logical cache holds 3 tiles out of 9
+  std::vector<size_t> fullDimension{2048, 2048}, tileDimension{512, 512};
+  auto nbLoads = std::make_shared<std::atomic<size_t>>(0);
+  auto tl = std::make_shared<CountingVirtualFileTileLoader>(fullDimension, tileDimension, nbLoads);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+  options->cacheCapacityMB({8});
+  auto fl = fl::AdaptiveFastLoaderGraph<fl::DefaultView<int>>(std::move(options), {{768, 768}}, {8});
+  ASSERT_TRUE(fl.logicalCacheUsed());
+  fl.executeGraph();
+
+  auto getView = [&fl]() {
+    auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*fl.getBlockingResult());
+    auto index = view->indexCentralTile();
+    ASSERT_EQ(view->originCentralTile()[0], (int) (10 * 768 * index.at(0) + 768 * index.at(1)));
+    view->returnToMemoryManager();
+  };
+  auto interactive = [&fl, &getView]() {
+    fl.requestView({0, 0});
+    getView();
+    fl.requestView({1, 1});
+    getView();
+  };
+
+  interactive();
+  fl.requestAllViews(0, noCache);
+  for (size_t view = 0; view < 9; ++view) { getView(); }
+  size_t const nbLoadsBeforeInteractive = nbLoads->load();
+  interactive();
+
+  fl.finishRequestingViews();
+  fl.waitForTermination();
+  // With the hint, the hot logical tiles are still cached and no physical tile is loaded
+  if (noCache) { ASSERT_EQ(nbLoads->load(), nbLoadsBeforeInteractive); }
+  else { ASSERT_GT(nbLoads->load(), nbLoadsBeforeInteractive); }
+}
+
+class GatedVirtualFileTileLoader : public VirtualFileTileLoader {
+  std::shared_ptr<std::atomic<bool>> gate_;
+
+ public:
+  GatedVirtualFileTileLoader(std::vector<size_t> const &fullDimension, std::vector<size_t> const &tileDimension,
+                             std::shared_ptr<std::atomic<bool>> gate)
+      : VirtualFileTileLoader(1, fullDimension, tileDimension), gate_(std::move(gate)) {}
+
+  void loadTileFromFile(std::shared_ptr<fl::TileBuffer<int>> tile, std::vector<size_t> const &index,
+                        size_t level) override {
+    while (!gate_->load()) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+    VirtualFileTileLoader::loadTileFromFile(tile, index, level);
+  }
+
+  std::shared_ptr<fl::AbstractTileLoader<fl::DefaultView<int>>> copyTileLoader() override {
+    return std::make_shared<GatedVirtualFileTileLoader>(this->fullDims(0), this->tileDims(0), gate_);
+  }
+};
+
+void testRequestPriority(bool ordered) {
+  std::vector<size_t> fullDimension{1024, 1024}, tileDimension{256, 256};
+  auto gate = std::make_shared<std::atomic<bool>>(false);
+  auto tl = std::make_shared<GatedVirtualFileTileLoader>(fullDimension, tileDimension, gate);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+  options->requestWindow(1);
+  options->ordered(ordered);
+  auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+  fl.executeGraph();
+
+  // The batch is blocked on its first view while the interactive views are requested
+  fl.requestAllViews(0, true);
+  fl.requestView({3, 3}, 0, false, 10);
+  fl.requestRegion({100, 100}, {10, 10}, 0, 5);
+  // A request of the batch priority goes after the next view of the batch, not after the whole batch
+  fl.requestView({2, 2}, 0, false, 0);
+  fl.finishRequestingViews();
+  gate->store(true);
+
+  std::vector<std::vector<size_t>> order;
+  while (auto viewVariant = fl.getBlockingResult()) {
+    auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*viewVariant);
+    order.push_back(view->viewData()->isRegion() ? std::vector<size_t>{} : view->indexCentralTile());
+    view->returnToMemoryManager();
+  }
+  fl.waitForTermination();
+
+  ASSERT_EQ(order.size(), (size_t) 19);
+  ASSERT_EQ(order.at(0), std::vector<size_t>({0, 0}));
+  ASSERT_EQ(order.at(1), std::vector<size_t>({3, 3}));
+  ASSERT_EQ(order.at(2), std::vector<size_t>{});
+  ASSERT_EQ(order.at(3), std::vector<size_t>({0, 1}));
+  ASSERT_EQ(order.at(4), std::vector<size_t>({2, 2}));
+  ASSERT_EQ(order.at(5), std::vector<size_t>({0, 2}));
+}
+
+void testCancelRequests(size_t requestWindow, bool ordered) {
+  std::vector<size_t> fullDimension{1024, 1024}, tileDimension{256, 256};
+  auto gate = std::make_shared<std::atomic<bool>>(false);
+  auto tl = std::make_shared<GatedVirtualFileTileLoader>(fullDimension, tileDimension, gate);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+  options->requestWindow(requestWindow);
+  options->ordered(ordered);
+  auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+  fl.executeGraph();
+
+  std::vector<std::shared_ptr<fl::RequestHandle>> handles;
+  for (size_t row = 0; row < 4; ++row) {
+    for (size_t col = 0; col < 4; ++col) { handles.push_back(fl.requestView({row, col})); }
+  }
+  fl.finishRequestingViews();
+  ASSERT_EQ(fl.requestView({0, 0}), nullptr);
+
+  // The first view is being loaded, the last row is waiting
+  ASSERT_TRUE(handles.at(0)->cancel());
+  ASSERT_FALSE(handles.at(0)->cancel());
+  ASSERT_EQ(fl.cancelRequests(0, {800, 0}, {10, 1024}), (size_t) 4);
+  ASSERT_EQ(fl.cancelRequests(1), (size_t) 0);
+  gate->store(true);
+
+  std::vector<std::vector<size_t>> received;
+  bool dataValid = true;
+  while (auto viewVariant = fl.getBlockingResult()) {
+    auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*viewVariant);
+    auto const &index = view->indexCentralTile();
+    received.push_back(index);
+    dataValid &= view->viewData()->data()[0] == (int) (index.at(0) * 2560 + index.at(1) * 256);
+    view->returnToMemoryManager();
+  }
+  fl.waitForTermination();
+
+  ASSERT_TRUE(dataValid);
+  ASSERT_EQ(received.size(), (size_t) 11);
+  for (auto const &index : received) {
+    ASSERT_NE(index, std::vector<size_t>({0, 0}));
+    ASSERT_NE(index.at(0), (size_t) 3);
+  }
+  for (auto const &handle : handles) {
+    ASSERT_TRUE(handle->done());
+    ASSERT_FALSE(handle->cancel());
+  }
+}
+
+void testCancelDeliveryRace() {
+  // A request cancelled while its view is sent is either served or dropped, and cancel tells which
+  std::vector<size_t> fullDimension{1024, 1024}, tileDimension{64, 64};
+  auto tl = std::make_shared<VirtualFileTileLoader>(2, fullDimension, tileDimension);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+  options->viewAvailable({4});
+  auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+  fl.executeGraph();
+
+  std::vector<std::shared_ptr<fl::RequestHandle>> handles;
+  for (size_t row = 0; row < 16; ++row) {
+    for (size_t col = 0; col < 16; ++col) { handles.push_back(fl.requestView({row, col})); }
+  }
+  fl.finishRequestingViews();
+  std::vector<bool> cancelled(handles.size(), false);
+  std::thread canceller([&handles, &cancelled]() {
+    for (size_t request = 0; request < handles.size(); request += 2) {
+      cancelled.at(request) = handles.at(request)->cancel();
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+  });
+
+  std::vector<bool> received(handles.size(), false);
+  while (auto viewVariant = fl.getBlockingResult()) {
+    auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*viewVariant);
+    received.at(view->indexCentralTile().at(0) * 16 + view->indexCentralTile().at(1)) = true;
+    view->returnToMemoryManager();
+  }
+  canceller.join();
+  fl.waitForTermination();
+
+  for (size_t request = 0; request < handles.size(); ++request) {
+    ASSERT_NE(received.at(request), cancelled.at(request));
+    ASSERT_TRUE(handles.at(request)->done());
+    ASSERT_EQ(handles.at(request)->cancelled(), cancelled.at(request));
+  }
+
+  fl::RequestHandle delivered(0, {}, {}), dropped(0, {}, {});
+  ASSERT_TRUE(delivered.deliver());
+  ASSERT_FALSE(delivered.cancel());
+  ASSERT_FALSE(delivered.cancelled());
+  ASSERT_TRUE(dropped.cancel());
+  ASSERT_FALSE(dropped.deliver());
+  ASSERT_TRUE(dropped.done());
+}
+
+void testCoalesceRequests() {
+  std::vector<size_t> fullDimension{1024, 1024}, tileDimension{256, 256};
+  auto gate = std::make_shared<std::atomic<bool>>(false);
+  auto tl = std::make_shared<GatedVirtualFileTileLoader>(fullDimension, tileDimension, gate);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+  options->viewAvailable({2});
+  options->coalesceRequests(true);
+  auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+  fl.executeGraph();
+
+  // The duplicates are requested while the first view is being loaded, one of them is cancelled
+  fl.requestView({1, 1});
+  fl.requestView({1, 1});
+  auto cancelled = fl.requestView({1, 1});
+  fl.requestView({2, 2});
+  ASSERT_TRUE(cancelled->cancel());
+  gate->store(true);
+
+  std::vector<std::pair<std::vector<size_t>, std::shared_ptr<fl::DefaultView<int>>>> views;
+  bool dataValid = true;
+  for (size_t view = 0; view < 3; ++view) {
+    auto received = std::get<std::shared_ptr<fl::DefaultView<int>>>(*fl.getBlockingResult());
+    auto const &index = received->indexCentralTile();
+    dataValid &= received->viewData()->data()[0] == (int) (index.at(0) * 2560 + index.at(1) * 256);
+    views.emplace_back(index, received);
+  }
+  for (auto const &view : views) { view.second->returnToMemoryManager(); }
+
+  // The views are recycled once returned for each request
+  for (size_t col = 0; col < 4; ++col) { fl.requestView({0, col}); }
+  fl.finishRequestingViews();
+  size_t nbViews = 0;
+  while (auto viewVariant = fl.getBlockingResult()) {
+    std::get<std::shared_ptr<fl::DefaultView<int>>>(*viewVariant)->returnToMemoryManager();
+    ++nbViews;
+  }
+  fl.waitForTermination();
+
+  ASSERT_TRUE(dataValid);
+  ASSERT_TRUE(cancelled->done());
+  std::sort(views.begin(), views.end(), [](auto const &lhs, auto const &rhs) { return lhs.first < rhs.first; });
+  ASSERT_EQ(views.at(0).first, std::vector<size_t>({1, 1}));
+  ASSERT_EQ(views.at(1).first, std::vector<size_t>({1, 1}));
+  ASSERT_EQ(views.at(0).second, views.at(1).second);
+  ASSERT_EQ(views.at(2).first, std::vector<size_t>({2, 2}));
+  ASSERT_EQ(nbViews, (size_t) 4);
+}
+
+void testElasticViewPool() {
+  std::vector<size_t> fullDimension{1024, 1024}, tileDimension{256, 256};
+  auto tl = std::make_shared<VirtualFileTileLoader>(1, fullDimension, tileDimension);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+  options->viewAvailable({1});
+  // A view is 256KB, the pool can grow to 4 views
+  options->elasticViewPool({1}, std::chrono::milliseconds(50));
+  auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+  fl.executeGraph();
+
+  // The views are held, a static pool of 1 view would starve
+  for (size_t col = 0; col < 4; ++col) { fl.requestView({0, col}); }
+  std::vector<std::shared_ptr<fl::DefaultView<int>>> views;
+  for (size_t view = 0; view < 4; ++view) {
+    views.push_back(std::get<std::shared_ptr<fl::DefaultView<int>>>(*fl.getBlockingResult()));
+  }
+  auto grown = fl.viewPoolStatistics(0);
+  for (auto const &view : views) { view->returnToMemoryManager(); }
+
+  // The views unused for the idle timeout are freed without waiting for the next request
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  auto trimmed = fl.viewPoolStatistics(0);
+  fl.requestView({1, 0});
+  fl.finishRequestingViews();
+  while (auto viewVariant = fl.getBlockingResult()) {
+    std::get<std::shared_ptr<fl::DefaultView<int>>>(*viewVariant)->returnToMemoryManager();
+  }
+  fl.waitForTermination();
+  auto shrunk = fl.viewPoolStatistics(0);
+
+  ASSERT_EQ(trimmed.nbViews, (size_t) 1);
+  ASSERT_EQ(trimmed.nbShrunk, (size_t) 3);
+  ASSERT_EQ(grown.nbViews, (size_t) 4);
+  ASSERT_EQ(grown.nbGrown, (size_t) 3);
+  ASSERT_GE(grown.nbBlocked, (size_t) 3);
+  ASSERT_GT(grown.blockedTime.count(), 0);
+  ASSERT_EQ(shrunk.nbViews, (size_t) 1);
+  ASSERT_EQ(shrunk.nbShrunk, (size_t) 3);
+  ASSERT_THROW((void) fl.viewPoolStatistics(1), std::runtime_error);
+}
+
+void testBoundedRequestAllViews(bool ordered) {
+  // The positions computed one at a time follow the generated traversal
+  fl::internal::NaiveTraversal naiveTraversal;
+  std::vector<size_t> const nbTiles{3, 4, 5};
+  auto const positions = naiveTraversal.traversal(nbTiles);
+  for (size_t step = 0; step < positions.size(); ++step) {
+    ASSERT_EQ(naiveTraversal.position(nbTiles, step), positions.at(step));
+  }
+
+  // 1600 views streamed through a window of 4 requests
+  {
+    std::vector<size_t> fullDimension{640, 640}, tileDimension{16, 16};
+    auto tl = std::make_shared<VirtualFileTileLoader>(2, fullDimension, tileDimension);
+    auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+    options->requestWindow(4);
+    options->ordered(ordered);
+    auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+    fl.executeGraph();
+    fl.requestAllViews();
+    fl.finishRequestingViews();
+
+    std::vector<std::vector<size_t>> received;
+    bool dataValid = true;
+    while (auto viewVariant = fl.getBlockingResult()) {
+      auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*viewVariant);
+      auto const &index = view->indexCentralTile();
+      received.push_back(index);
+      dataValid &= view->viewData()->data()[0] == (int) (index.at(0) * 10 * 16 + index.at(1) * 16);
+      view->returnToMemoryManager();
+    }
+    fl.waitForTermination();
+
+    ASSERT_TRUE(dataValid);
+    ASSERT_EQ(received.size(), (size_t) 1600);
+    if (ordered) { ASSERT_EQ(received, naiveTraversal.traversal({40, 40})); }
+    std::sort(received.begin(), received.end());
+    ASSERT_EQ(received, naiveTraversal.traversal({40, 40}));
+  }
+
+  // Cancelling the level stops the stream, the requests not created yet are never loaded
+  {
+    std::vector<size_t> fullDimension{1024, 1024}, tileDimension{256, 256};
+    auto gate = std::make_shared<std::atomic<bool>>(false);
+    auto tl = std::make_shared<GatedVirtualFileTileLoader>(fullDimension, tileDimension, gate);
+    auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+    options->requestWindow(2);
+    options->ordered(ordered);
+    auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+    fl.executeGraph();
+    fl.requestAllViews();
+    fl.finishRequestingViews();
+
+    // The 2 requests admitted and the stream
+    auto const nbCancelled = fl.cancelRequests(0);
+    gate->store(true);
+    size_t nbReceived = 0;
+    while (auto viewVariant = fl.getBlockingResult()) {
+      std::get<std::shared_ptr<fl::DefaultView<int>>>(*viewVariant)->returnToMemoryManager();
+      ++nbReceived;
+    }
+    fl.waitForTermination();
+
+    ASSERT_EQ(nbCancelled, (size_t) 3);
+    ASSERT_EQ(nbReceived, (size_t) 0);
+  }
+}
+
+class ConcurrencyTileLoader : public fl::AbstractTileLoader<fl::DefaultView<int>> {
+  std::vector<size_t> const fullDimension_{64, 64}, tileDimension_{16, 16};
+  std::vector<std::string> const names_{"", ""};
+  std::shared_ptr<std::vector<std::atomic<size_t>>> nbRunningPerLevel_, maxRunningPerLevel_;
+  std::shared_ptr<std::atomic<size_t>> nbRunning_, maxRunning_;
+
+ public:
+  ConcurrencyTileLoader(size_t numberThreads,
+                        std::shared_ptr<std::vector<std::atomic<size_t>>> nbRunningPerLevel,
+                        std::shared_ptr<std::vector<std::atomic<size_t>>> maxRunningPerLevel,
+                        std::shared_ptr<std::atomic<size_t>> nbRunning, std::shared_ptr<std::atomic<size_t>> maxRunning)
+      : fl::AbstractTileLoader<fl::DefaultView<int>>("ConcurrencyTileLoader", "filePath", numberThreads),
+        nbRunningPerLevel_(std::move(nbRunningPerLevel)), maxRunningPerLevel_(std::move(maxRunningPerLevel)),
+        nbRunning_(std::move(nbRunning)), maxRunning_(std::move(maxRunning)) {}
+
+  void loadTileFromFile(std::shared_ptr<fl::TileBuffer<int>> tile, std::vector<size_t> const &index,
+                        size_t level) override {
+    auto const nbRunningLevel = ++nbRunningPerLevel_->at(level), nbRunning = ++(*nbRunning_);
+    size_t max = maxRunningPerLevel_->at(level);
+    while (max < nbRunningLevel && !maxRunningPerLevel_->at(level).compare_exchange_weak(max, nbRunningLevel)) {}
+    max = *maxRunning_;
+    while (max < nbRunning && !maxRunning_->compare_exchange_weak(max, nbRunning)) {}
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    std::fill(tile->begin(), tile->end(), (int) (level * 100 + index.at(0) * 10 + index.at(1)));
+    --nbRunningPerLevel_->at(level);
+    --(*nbRunning_);
+  }
+
+  [[nodiscard]] size_t nbDims() const override { return 2; }
+  [[nodiscard]] size_t nbPyramidLevels() const override { return 2; }
+  [[nodiscard]] std::vector<size_t> const &fullDims([[maybe_unused]] size_t level) const override {
+    return fullDimension_;
+  }
+  [[nodiscard]] std::vector<size_t> const &tileDims([[maybe_unused]] size_t level) const override {
+    return tileDimension_;
+  }
+  [[nodiscard]] std::vector<std::string> const &dimNames() const override { return names_; }
+
+  std::shared_ptr<fl::AbstractTileLoader<fl::DefaultView<int>>> copyTileLoader() override {
+    return std::make_shared<ConcurrencyTileLoader>(
+        this->numberThreads(), nbRunningPerLevel_, maxRunningPerLevel_, nbRunning_, maxRunning_);
+  }
+};
+
+void testLevelThreads(bool shared) {
+  auto nbRunningPerLevel = std::make_shared<std::vector<std::atomic<size_t>>>(2);
+  auto maxRunningPerLevel = std::make_shared<std::vector<std::atomic<size_t>>>(2);
+  auto nbRunning = std::make_shared<std::atomic<size_t>>(0), maxRunning = std::make_shared<std::atomic<size_t>>(0);
+  auto tl = std::make_shared<ConcurrencyTileLoader>(4, nbRunningPerLevel, maxRunningPerLevel, nbRunning, maxRunning);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+  options->viewAvailable({8, 8});
+  // 4 threads per level, at most 3 loading at level 0 and 1 at level 1, or 2 loading across the levels
+  if (shared) { options->sharedLevelThreads(2, 1); }
+  else { options->levelThreads({3, 1}, {0, 1}); }
+  auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+  fl.executeGraph();
+  fl.requestAllViews(0);
+  fl.requestAllViews(1);
+  fl.finishRequestingViews();
+
+  size_t nbReceived = 0;
+  bool dataValid = true;
+  while (auto viewVariant = fl.getBlockingResult()) {
+    auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*viewVariant);
+    auto const &index = view->indexCentralTile();
+    dataValid &= view->viewData()->data()[0] == (int) (view->level() * 100 + index.at(0) * 10 + index.at(1));
+    view->returnToMemoryManager();
+    ++nbReceived;
+  }
+  fl.waitForTermination();
+
+  ASSERT_TRUE(dataValid);
+  ASSERT_EQ(nbReceived, (size_t) 32);
+  if (shared) {
+    ASSERT_LE(maxRunning->load(), (size_t) 2);
+  } else {
+    ASSERT_LE(maxRunningPerLevel->at(0).load(), (size_t) 3);
+    ASSERT_EQ(maxRunningPerLevel->at(1).load(), (size_t) 1);
+  }
+  ASSERT_THROW(fl::FastLoaderConfiguration<fl::DefaultView<int>>(tl).levelThreads({1}, {1}), std::runtime_error);
+}
+
+class LevelGatedTileLoader : public ConcurrencyTileLoader {
+  std::shared_ptr<std::atomic<bool>> gate_;
+  std::shared_ptr<std::atomic<size_t>> nbWaiting_;
+
+ public:
+  LevelGatedTileLoader(size_t numberThreads, std::shared_ptr<std::atomic<bool>> gate,
+                       std::shared_ptr<std::atomic<size_t>> nbWaiting)
+      : ConcurrencyTileLoader(numberThreads, std::make_shared<std::vector<std::atomic<size_t>>>(2),
+                              std::make_shared<std::vector<std::atomic<size_t>>>(2),
+                              std::make_shared<std::atomic<size_t>>(0), std::make_shared<std::atomic<size_t>>(0)),
+        gate_(std::move(gate)), nbWaiting_(std::move(nbWaiting)) {}
+
+  void loadTileFromFile(std::shared_ptr<fl::TileBuffer<int>> tile, std::vector<size_t> const &index,
+                        size_t level) override {
+    if (level == 0) {
+      ++*nbWaiting_;
+      while (!gate_->load()) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+    }
+    ConcurrencyTileLoader::loadTileFromFile(tile, index, level);
+  }
+
+  std::shared_ptr<fl::AbstractTileLoader<fl::DefaultView<int>>> copyTileLoader() override {
+    return std::make_shared<LevelGatedTileLoader>(this->numberThreads(), gate_, nbWaiting_);
+  }
+};
+
+void testLevelThreadsCacheHits() {
+  auto gate = std::make_shared<std::atomic<bool>>(true);
+  auto waiting = std::make_shared<std::atomic<size_t>>(0);
+  auto tl = std::make_shared<LevelGatedTileLoader>(1, gate, waiting);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+  options->sharedLevelThreads(1, 0);
+  auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+  fl.executeGraph();
+  auto getLevel = [&fl]() {
+    auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*fl.getBlockingResult());
+    size_t const level = view->level();
+    view->returnToMemoryManager();
+    return level;
+  };
+
+  // Cache a tile of the level 1, then hold the only running slot with a load of the level 0
+  fl.requestView({0, 0}, 1);
+  ASSERT_EQ(getLevel(), (size_t) 1);
+  *gate = false;
+  fl.requestView({0, 0}, 0);
+  while (waiting->load() == 0) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+  fl.requestView({0, 0}, 1);
+  std::thread opener([&gate]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    *gate = true;
+  });
+  // The cache hit of the level 1 is served without waiting for the running slot
+  size_t const firstLevel = getLevel();
+  bool const servedWhileLoading = !gate->load();
+  opener.join();
+  ASSERT_EQ(firstLevel, (size_t) 1);
+  ASSERT_TRUE(servedWhileLoading);
+  ASSERT_EQ(getLevel(), (size_t) 0);
+  fl.finishRequestingViews();
+  fl.waitForTermination();
+}
+
+void testCopyInTileLoader() {
+  auto nbRunningPerLevel = std::make_shared<std::vector<std::atomic<size_t>>>(2);
+  auto maxRunningPerLevel = std::make_shared<std::vector<std::atomic<size_t>>>(2);
+  auto nbRunning = std::make_shared<std::atomic<size_t>>(0), maxRunning = std::make_shared<std::atomic<size_t>>(0);
+  auto tl = std::make_shared<ConcurrencyTileLoader>(4, nbRunningPerLevel, maxRunningPerLevel, nbRunning, maxRunning);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+  options->viewAvailable({8, 8});
+  options->nbThreadsCopyPhysicalCacheView(1);
+  options->copyInTileLoader(2);
+  auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+  fl.executeGraph();
+  // The second pass is served by the cache, the tile loader threads only copy
+  for (size_t pass = 0; pass < 2; ++pass) {
+    fl.requestAllViews(0);
+    fl.requestAllViews(1);
+  }
+  fl.finishRequestingViews();
+
+  size_t nbReceived = 0;
+  bool dataValid = true;
+  while (auto viewVariant = fl.getBlockingResult()) {
+    auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*viewVariant);
+    auto const &index = view->indexCentralTile();
+    dataValid &= view->viewData()->data()[0] == (int) (view->level() * 100 + index.at(0) * 10 + index.at(1));
+    view->returnToMemoryManager();
+    ++nbReceived;
+  }
+  fl.waitForTermination();
+
+  ASSERT_TRUE(dataValid);
+  ASSERT_EQ(nbReceived, (size_t) 64);
+
+  // The loads waiting for the file hold no copy slot, the 2 other tile loader threads copy the cached tiles
+  auto gate = std::make_shared<std::atomic<bool>>(true);
+  auto waiting = std::make_shared<std::atomic<size_t>>(0);
+  auto gatedOptions = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(
+      std::make_shared<LevelGatedTileLoader>(4, gate, waiting));
+  gatedOptions->viewAvailable({2, 2});
+  gatedOptions->copyInTileLoader(2);
+  auto gatedFl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(gatedOptions));
+  gatedFl.executeGraph();
+  auto getLevel = [&gatedFl]() {
+    auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*gatedFl.getBlockingResult());
+    size_t const level = view->level();
+    view->returnToMemoryManager();
+    return level;
+  };
+  gatedFl.requestView({0, 0}, 1);
+  ASSERT_EQ(getLevel(), (size_t) 1);
+  *gate = false;
+  gatedFl.requestView({0, 0}, 0);
+  gatedFl.requestView({0, 1}, 0);
+  while (waiting->load() < 2) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+  gatedFl.requestView({0, 0}, 1);
+  std::thread opener([&gate]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    *gate = true;
+  });
+  size_t const firstLevel = getLevel();
+  bool const servedWhileLoading = !gate->load();
+  opener.join();
+  ASSERT_EQ(firstLevel, (size_t) 1);
+  ASSERT_TRUE(servedWhileLoading);
+  ASSERT_EQ(getLevel(), (size_t) 0);
+  ASSERT_EQ(getLevel(), (size_t) 0);
+  gatedFl.finishRequestingViews();
+  gatedFl.waitForTermination();
+
+  // The tiles are not copied to a TileAliasView
+  auto aliasOptions = std::make_unique<fl::FastLoaderConfiguration<fl::TileAliasView<int>>>(
+      std::make_shared<TypedVirtualFileTileLoader<fl::TileAliasView<int>>>(
+          1, std::vector<size_t>{16, 16}, std::vector<size_t>{4, 4}));
+  aliasOptions->copyInTileLoader(2);
+  ASSERT_THROW(fl::FastLoaderGraph<fl::TileAliasView<int>>(std::move(aliasOptions)), std::runtime_error);
+}
+
+class SaturatedStorageTileLoader : public VirtualFileTileLoader {
+  std::shared_ptr<std::counting_semaphore<>> storage_;
+
+ public:
+  SaturatedStorageTileLoader(size_t numberThreads, std::vector<size_t> const &fullDimension,
+                             std::vector<size_t> const &tileDimension,
+                             std::shared_ptr<std::counting_semaphore<>> storage)
+      : VirtualFileTileLoader(numberThreads, fullDimension, tileDimension), storage_(std::move(storage)) {}
+
+  void loadTileFromFile(std::shared_ptr<fl::TileBuffer<int>> tile, std::vector<size_t> const &index,
+                        size_t level) override {
+    storage_->acquire();
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    storage_->release();
+    VirtualFileTileLoader::loadTileFromFile(tile, index, level);
+  }
+
+  std::shared_ptr<fl::AbstractTileLoader<fl::DefaultView<int>>> copyTileLoader() override {
+    return std::make_shared<SaturatedStorageTileLoader>(
+        this->numberThreads(), this->fullDims(0), this->tileDims(0), storage_);
+  }
+};
+
+void testAutoTuneLoaderThreads() {
+  // The storage serves 2 loads at a time, the 8 threads of the tile loader are not needed
+  std::vector<size_t> fullDimension{32, 32}, tileDimension{1, 1};
+  auto storage = std::make_shared<std::counting_semaphore<>>(2);
+  auto tl = std::make_shared<SaturatedStorageTileLoader>(8, fullDimension, tileDimension, storage);
+  auto options = std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl);
+  options->viewAvailable({16});
+  options->autoTuneLoaderThreads(1, 0, std::chrono::milliseconds(20));
+  auto fl = fl::FastLoaderGraph<fl::DefaultView<int>>(std::move(options));
+  fl.executeGraph();
+  auto initial = fl.loaderTuningStatistics();
+  fl.requestAllViews();
+  fl.finishRequestingViews();
+
+  size_t nbReceived = 0;
+  bool dataValid = true;
+  while (auto viewVariant = fl.getBlockingResult()) {
+    auto view = std::get<std::shared_ptr<fl::DefaultView<int>>>(*viewVariant);
+    auto const &index = view->indexCentralTile();
+    dataValid &= view->viewData()->data()[0] == (int) (index.at(0) * 10 + index.at(1));
+    view->returnToMemoryManager();
+    ++nbReceived;
+  }
+  fl.waitForTermination();
+  auto tuned = fl.loaderTuningStatistics();
+
+  ASSERT_TRUE(dataValid);
+  ASSERT_EQ(nbReceived, (size_t) 1024);
+  // The timing depends on the machine, only the properties of the tuning are checked
+  ASSERT_EQ(initial.nbActiveThreads, (size_t) 8);
+  ASSERT_GE(tuned.nbActiveThreads, (size_t) 1);
+  ASSERT_LE(tuned.nbActiveThreads, (size_t) 8);
+  ASSERT_GE(tuned.nbAdjustments, (size_t) 1);
+  ASSERT_EQ(tuned.nbParkedThreads, (size_t) 0);
+  ASSERT_GT(tuned.throughput, 0.);
+  ASSERT_GT(tuned.loadLatency.count(), 0);
+  auto untuned = fl::FastLoaderGraph<fl::DefaultView<int>>(
+      std::make_unique<fl::FastLoaderConfiguration<fl::DefaultView<int>>>(tl));
+  ASSERT_THROW((void) untuned.loaderTuningStatistics(), std::runtime_error);
+}
+
+void testLoaderAutoTunerSettles() {
+  // Simulated storage serving 2 loads at a time, the periods are driven by a fake clock
+  std::chrono::milliseconds const period(10);
+  size_t const nbPeriods = 200;
+  fl::internal::LoaderAutoTuner tuner(1, 8, period);
+  auto now = std::chrono::steady_clock::now();
+  size_t nbPeriodsAtBest = 0;
+  for (size_t p = 0; p < nbPeriods; ++p) {
+    size_t const nbActive = tuner.statistics().nbActiveThreads;
+    ASSERT_GE(nbActive, (size_t) 1);
+    ASSERT_LE(nbActive, (size_t) 8);
+    if (nbActive == 2) { ++nbPeriodsAtBest; }
+    size_t const nbLoads = std::min(nbActive, (size_t) 2) * 10;
+    for (size_t thread = 0; thread < nbActive; ++thread) { tuner.acquire(); }
+    for (size_t load = 1; load <= nbLoads; ++load) {
+      tuner.release(std::chrono::milliseconds(1), load == nbLoads ? now + period : now);
+      if (load + nbActive <= nbLoads) { tuner.acquire(); }
+    }
+    now += period;
+  }
+  auto statistics = tuner.statistics();
+  // The tuner holds the best number of threads between two probes instead of changing it every period
+  ASSERT_GE(nbPeriodsAtBest, nbPeriods * 3 / 4);
+  ASSERT_LT(statistics.nbAdjustments, nbPeriods / 3);
+  ASSERT_EQ(statistics.nbParkedThreads, (size_t) 0);
+}
+
 #endif //FAST_LOADER_TEST_TILE_LOADER_H
@@ -23,15 +23,16 @@
 
 #include "../../fast_loader/fast_loader.h"
 
-class VirtualFileTileLoader : public fl::AbstractTileLoader<fl::DefaultView<int>> {
+template<class ViewType>
+class TypedVirtualFileTileLoader : public fl::AbstractTileLoader<ViewType> {
   std::vector<size_t> const fullDimension_, tileDimension_;
   std::vector<size_t> stridePerDimension_;
   std::shared_ptr<std::vector<int>> file_{};
   std::vector<std::string> names_{};
 
  public:
-  VirtualFileTileLoader(size_t const numberThreads, std::vector<size_t> fullDimension, std::vector<size_t> tileDimension)
-      : AbstractTileLoader("VirtualFileTileLoader", "filePath", numberThreads),
+  TypedVirtualFileTileLoader(size_t const numberThreads, std::vector<size_t> fullDimension, std::vector<size_t> tileDimension)
+      : fl::AbstractTileLoader<ViewType>("VirtualFileTileLoader", "filePath", numberThreads),
         fullDimension_(std::move(fullDimension)), tileDimension_(std::move(tileDimension)) {
     file_ = std::make_shared<std::vector<int>>(std::accumulate(fullDimension_.cbegin(),
                                                                fullDimension_.cend(),
@@ -49,10 +50,10 @@ class VirtualFileTileLoader : public fl::AbstractTileLoader<fl::DefaultView<int>
     names_ = std::vector<std::string>(fullDimension_.size(), "");
   }
 
-  ~VirtualFileTileLoader() override = default;
+  ~TypedVirtualFileTileLoader() override = default;
 
   void loadTileFromFile(
-      std::shared_ptr<std::vector<int>> tile,
+      std::shared_ptr<fl::TileBuffer<int>> tile,
       std::vector<size_t> const &index, [[maybe_unused]]size_t level) override {
     std::fill_n(tile->begin(), tile->size(), 69);
     std::vector<size_t> nbCopiesPerDimension(index.size(), 0);
@@ -65,8 +66,8 @@ class VirtualFileTileLoader : public fl::AbstractTileLoader<fl::DefaultView<int>
   [[nodiscard]] std::vector<size_t> const & tileDims([[maybe_unused]] size_t const level) const override { return tileDimension_; }
   [[nodiscard]] std::vector<std::string> const & dimNames() const override { return names_; }
 
-  std::shared_ptr<AbstractTileLoader> copyTileLoader() override {
-    return std::make_shared<VirtualFileTileLoader>(this->numberThreads(), fullDimension_, tileDimension_);
+  std::shared_ptr<fl::AbstractTileLoader<ViewType>> copyTileLoader() override {
+    return std::make_shared<TypedVirtualFileTileLoader>(this->numberThreads(), fullDimension_, tileDimension_);
   }
 
  private:
@@ -91,7 +92,7 @@ class VirtualFileTileLoader : public fl::AbstractTileLoader<fl::DefaultView<int>
     if (dimension != fullDimension_.size() - 1) { fillFile(dimension + 1); }
   }
 
-  inline void fillBuffer(std::shared_ptr<std::vector<int>> const &tile,
+  inline void fillBuffer(std::shared_ptr<fl::TileBuffer<int>> const &tile,
                          std::vector<size_t> const &index,
                          std::vector<size_t> nbCopiesPerDimension,
                          size_t const &posStartCpySrc = 0,
@@ -122,4 +123,6 @@ class VirtualFileTileLoader : public fl::AbstractTileLoader<fl::DefaultView<int>
 
 };
 
+using VirtualFileTileLoader = TypedVirtualFileTileLoader<fl::DefaultView<int>>;
+
 #endif //FAST_LOADER_VIRTUAL_FILE_TILE_LOADER_H